@@ -94,6 +94,33 @@ public:
 	}
 };
 
+// Streams the time threaded resource loads spend in each stage, as
+// [path, queued, dependencies, load, wait] quintuplets in microseconds.
+class RemoteDebugger::ResourceLoaderProfiler : public EngineProfiler {
+public:
+	void toggle(bool p_enable, const Array &p_opts) {
+		ResourceLoader::set_load_stage_profiling(p_enable);
+	}
+	void add(const Array &p_data) {}
+	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+		LocalVector<ResourceLoader::LoadStageTimes> times;
+		ResourceLoader::take_load_stage_times(times);
+		if (times.is_empty()) {
+			return;
+		}
+
+		Array arr;
+		for (const ResourceLoader::LoadStageTimes &E : times) {
+			arr.push_back(E.path);
+			arr.push_back(E.queued_usec);
+			arr.push_back(E.dependencies_usec);
+			arr.push_back(E.load_usec);
+			arr.push_back(E.wait_usec);
+		}
+		EngineDebugger::get_singleton()->send_message("resource_loader:load_stages", arr);
+	}
+};
+
 Error RemoteDebugger::_put_msg(const String &p_message, const Array &p_data) {
 	Array msg;
 	msg.push_back(p_message);
@@ -706,6 +733,10 @@ RemoteDebugger::RemoteDebugger(Ref<RemoteDebuggerPeer> p_peer) {
 		profiler_enable("performance", true);
 	}
 
+	// Resource Loader Profiler
+	resource_loader_profiler.instantiate();
+	resource_loader_profiler->bind("resource_loader");
+
 	// Core and profiler captures.
 	Capture core_cap(this,
 			[](void *p_user, const String &p_cmd, const Array &p_data, bool &r_captured) {
@@ -156,6 +156,8 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	virtual const uint8_t *get_mapped_span(uint64_t p_length) const { return nullptr; } ///< get the next bytes in place and advance, only if the file is memory-mapped and they are all available; null otherwise. Valid while the file is open.
+	virtual void prefetch(uint64_t p_offset, uint64_t p_length) const {} ///< hint that a range will be read soon, so the OS can start caching it; reads nothing and leaves the position alone.
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
@@ -30,6 +30,7 @@
 
 #include "file_access_compressed.h"
 
+#include "core/io/marshalls.h"
 #include "core/string/print_string.h"
 
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
@@ -89,6 +90,42 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	return ret == -1 ? ERR_FILE_CORRUPT : OK;
 }
 
+Vector<uint8_t> FileAccessCompressed::compress_buffer(const uint8_t *p_src, uint64_t p_length, const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
+	ERR_FAIL_COND_V(p_block_size == 0, Vector<uint8_t>());
+	ERR_FAIL_COND_V_MSG(p_length > UINT32_MAX, Vector<uint8_t>(), "Compressed files can't be larger than 4 GiB.");
+
+	CharString mgc = (p_magic + "    ").substr(0, 4).ascii();
+	uint32_t bc = (p_length / p_block_size) + 1;
+	uint64_t header_size = 16 + bc * 4;
+
+	// Blocks are compressed straight after the header, whose block sizes are filled in as they are known.
+	Vector<uint8_t> out;
+	out.resize(header_size);
+	uint8_t *w = out.ptrw();
+	memcpy(w, mgc.get_data(), 4); //header 4
+	encode_uint32(p_mode, &w[4]); //compression mode 4
+	encode_uint32(p_block_size, &w[8]); //block size 4
+	encode_uint32(p_length, &w[12]); //max amount of data written 4
+
+	uint64_t out_pos = header_size;
+	for (uint32_t i = 0; i < bc; i++) {
+		uint32_t bl = i == (bc - 1) ? p_length % p_block_size : p_block_size;
+		const uint8_t *bp = &p_src[(uint64_t)i * p_block_size];
+
+		out.resize(out_pos + Compression::get_max_compressed_buffer_size(bl, p_mode));
+		int s = Compression::compress(out.ptrw() + out_pos, bp, bl, p_mode);
+		ERR_FAIL_COND_V(s < 0, Vector<uint8_t>());
+
+		encode_uint32(s, &out.ptrw()[16 + i * 4]);
+		out_pos += s;
+	}
+
+	out.resize(out_pos + 4);
+	memcpy(out.ptrw() + out_pos, mgc.get_data(), 4); //magic at the end too
+
+	return out;
+}
+
 Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags) {
 	ERR_FAIL_COND_V(p_mode_flags == READ_WRITE, ERR_UNAVAILABLE);
 	_close();
@@ -132,37 +169,8 @@ void FileAccessCompressed::_close() {
 
 	if (writing) {
 		//save block table and all compressed blocks
-
-		CharString mgc = magic.utf8();
-		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //write header 4
-		f->store_32(cmode); //write compression mode 4
-		f->store_32(block_size); //write block size 4
-		f->store_32(write_max); //max amount of data written 4
-		uint32_t bc = (write_max / block_size) + 1;
-
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(0); //compressed sizes, will update later
-		}
-
-		Vector<int> block_sizes;
-		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
-
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
-
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
-		}
-
-		f->seek(16); //ok write block sizes
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(block_sizes[i]);
-		}
-		f->seek_end();
-		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
+		Vector<uint8_t> data = compress_buffer(write_ptr, write_max, magic, cmode, block_size);
+		f->store_buffer(data.ptr(), data.size());
 
 		buffer.clear();
 
@@ -270,9 +278,12 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 		return 0;
 	}
 
-	for (uint64_t i = 0; i < p_length; i++) {
-		p_dst[i] = read_ptr[read_pos];
-		read_pos++;
+	uint64_t dst_pos = 0;
+	while (dst_pos < p_length) {
+		uint64_t to_copy = MIN(p_length - dst_pos, (uint64_t)read_block_size - read_pos);
+		memcpy(p_dst + dst_pos, read_ptr + read_pos, to_copy);
+		dst_pos += to_copy;
+		read_pos += to_copy;
 		if (read_pos >= read_block_size) {
 			read_block++;
 
@@ -287,10 +298,10 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 			} else {
 				read_block--;
 				at_end = true;
-				if (i + 1 < p_length) {
+				if (dst_pos < p_length) {
 					read_eof = true;
 				}
-				return i + 1;
+				return dst_pos;
 			}
 		}
 	}
@@ -30,7 +30,9 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
+#include "core/io/file_access_memory.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/version.h"
@@ -47,7 +49,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -55,6 +57,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -194,6 +197,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	if (f.is_null()) {
 		return false;
 	}
+	const String path_absolute = f->get_path_absolute();
 
 	bool pck_header_found = false;
 
@@ -265,7 +269,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	uint32_t ver_minor = f->get_32();
 	f->get_32(); // patch number, not used for validation.
 
-	ERR_FAIL_COND_V_MSG(version != PACK_FORMAT_VERSION, false, vformat("Pack version unsupported: %d.", version));
+	ERR_FAIL_COND_V_MSG(version < 2 || version > PACK_FORMAT_VERSION, false, vformat("Pack version unsupported: %d.", version));
 	ERR_FAIL_COND_V_MSG(ver_major > VERSION_MAJOR || (ver_major == VERSION_MAJOR && ver_minor > VERSION_MINOR), false, vformat("Pack created with a newer version of the engine: %d.%d.", ver_major, ver_minor));
 
 	uint32_t pack_flags = f->get_32();
@@ -320,15 +324,68 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		if (flags & PACK_FILE_REMOVAL) { // The file was removed.
 			PackedData::get_singleton()->remove_path(path);
 		} else {
-			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_COMPRESSED));
 		}
 	}
 
+	_map_pack(p_path, path_absolute);
+
 	return true;
 }
 
+void PackedSourcePCK::_map_pack(const String &p_path, const String &p_path_absolute) {
+	if (sizeof(void *) < 8 || p_path_absolute.is_empty()) {
+		// Packs can be larger than the address space of 32-bit platforms allows to spare,
+		// and packs nested in other packs have no file of their own.
+		return;
+	}
+
+	// Packs shipped with the executable only change when the game is updated. Others, such as downloaded
+	// content or mods, may be rewritten while the game runs, which a mapping doesn't survive (see `OS::map_file()`).
+	const String pack_dir = p_path_absolute.replace("\\", "/").get_base_dir();
+	const String executable_dir = OS::get_singleton()->get_executable_path().replace("\\", "/").get_base_dir();
+	const String bundle_dir = OS::get_singleton()->get_bundle_resource_dir().replace("\\", "/");
+	if (pack_dir != executable_dir && pack_dir != bundle_dir) {
+		return;
+	}
+
+	MappedPack mapped;
+	mapped.data = OS::get_singleton()->map_file(p_path_absolute, mapped.length);
+	if (!mapped.data) {
+		return;
+	}
+
+	MutexLock lock(mapped_packs_mutex);
+	MappedPack *previous = mapped_packs.getptr(p_path);
+	if (previous) {
+		replaced_packs.push_back(*previous);
+	}
+	mapped_packs[p_path] = mapped;
+}
+
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file) {
-	return memnew(FileAccessPack(p_path, *p_file));
+	const uint8_t *mapped_data = nullptr;
+	uint64_t mapped_length = 0;
+	if (!p_file->encrypted) {
+		MutexLock lock(mapped_packs_mutex);
+		const MappedPack *mapped = mapped_packs.getptr(p_file->pack);
+		// The stored size of compressed files isn't known up front, only that they're within the pack.
+		uint64_t stored_size = p_file->compressed ? 0 : p_file->size;
+		if (mapped && p_file->offset + stored_size <= mapped->length) {
+			mapped_data = mapped->data + p_file->offset;
+			mapped_length = mapped->length - p_file->offset;
+		}
+	}
+	return memnew(FileAccessPack(p_path, *p_file, mapped_data, mapped_length));
+}
+
+PackedSourcePCK::~PackedSourcePCK() {
+	for (const KeyValue<String, MappedPack> &E : mapped_packs) {
+		OS::get_singleton()->unmap_file(E.value.data, E.value.length);
+	}
+	for (const MappedPack &mapped : replaced_packs) {
+		OS::get_singleton()->unmap_file(mapped.data, mapped.length);
+	}
 }
 
 //////////////////////////////////////////////////////////////////
@@ -339,7 +396,9 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (mapped_data) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -347,7 +406,7 @@ bool FileAccessPack::is_open() const {
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped_data, "File must be opened before use.");
 
 	if (p_position > pf.size) {
 		eof = true;
@@ -355,7 +414,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (f.is_valid()) {
+		f->seek(off + MIN(p_position, pf.size)); // Compressed files can't seek past their end.
+	}
 	pos = p_position;
 }
 
@@ -376,7 +437,7 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(f.is_null() && !mapped_data, -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -389,21 +450,50 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
-	pos += to_read;
-
 	if (to_read <= 0) {
+		pos += to_read;
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+	if (mapped_data) {
+		memcpy(p_dst, mapped_data + pos, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
+	pos += to_read;
 
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::get_mapped_span(uint64_t p_length) const {
+	if (!mapped_data || eof || p_length > pf.size - pos) {
+		return nullptr;
+	}
+
+	const uint8_t *span = mapped_data + pos;
+	pos += p_length;
+	return span;
+}
+
+void FileAccessPack::prefetch(uint64_t p_offset, uint64_t p_length) const {
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped_data, "File must be opened before use.");
+	if (pf.encrypted || pf.compressed || p_offset >= pf.size) {
+		return; // Read through a wrapper, the stored bytes don't map to this range.
+	}
+	p_length = MIN(p_length, pf.size - p_offset);
+	if (mapped_data) {
+		OS::get_singleton()->prefetch_mapped(mapped_data + p_offset, p_length);
+	} else {
+		f->prefetch(off + p_offset, p_length);
+	}
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped_data, "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -427,15 +517,47 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapped_data = nullptr;
+}
+
+void FileAccessPack::_open_compressed(Ref<FileAccess> p_base) {
+	// Only the blocks that are read or seeked to get decompressed, using the block index at the start of the stream.
+	f.unref();
+	mapped_data = nullptr;
+	off = 0;
+
+	uint8_t magic[4];
+	if (p_base->get_buffer(magic, 4) != 4 || memcmp(magic, "GCMP", 4) != 0) {
+		ERR_FAIL_MSG(vformat("Can't open compressed pack-referenced file '%s'.", String(pf.pack)));
+	}
+
+	Ref<FileAccessCompressed> fac;
+	fac.instantiate();
+	Error err = fac->open_after_magic(p_base);
+	ERR_FAIL_COND_MSG(err != OK || fac->get_length() != pf.size, vformat("Can't open compressed pack-referenced file '%s'.", String(pf.pack)));
+	f = fac;
 }
 
-FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
+FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const uint8_t *p_mapped_data, uint64_t p_mapped_length) :
 		pf(p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
+		mapped_data(p_mapped_data) {
+	pos = 0;
+	eof = false;
+	off = pf.offset;
+	if (mapped_data) {
+		if (pf.compressed) {
+			Ref<FileAccessMemory> fam;
+			fam.instantiate();
+			fam->open_custom(mapped_data, p_mapped_length);
+			_open_compressed(fam);
+		}
+		return;
+	}
+
+	f = FileAccess::open(pf.pack, FileAccess::READ);
 	ERR_FAIL_COND_MSG(f.is_null(), vformat("Can't open pack-referenced file '%s'.", String(pf.pack)));
 
 	f->seek(pf.offset);
-	off = pf.offset;
 
 	if (pf.encrypted) {
 		Ref<FileAccessEncrypted> fae;
@@ -453,8 +575,10 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
-	pos = 0;
-	eof = false;
+
+	if (pf.compressed) {
+		_open_compressed(f);
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -33,15 +33,19 @@
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
 // The current packed file format version number.
-#define PACK_FORMAT_VERSION 2
+#define PACK_FORMAT_VERSION 3
+// Packs without compressed files are still written with the previous version, which older engines can read.
+#define PACK_FORMAT_VERSION_UNCOMPRESSED 2
 
 enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0,
@@ -51,6 +55,7 @@ enum PackFlags {
 enum PackFileFlags {
 	PACK_FILE_ENCRYPTED = 1 << 0,
 	PACK_FILE_REMOVAL = 1 << 1,
+	PACK_FILE_COMPRESSED = 1 << 2, // Since format version 3.
 };
 
 class PackSource;
@@ -64,10 +69,11 @@ public:
 	struct PackedFile {
 		String pack;
 		uint64_t offset; //if offset is ZERO, the file was ERASED
-		uint64_t size;
+		uint64_t size; // Uncompressed size.
 		uint8_t md5[16];
 		PackSource *src = nullptr;
 		bool encrypted;
+		bool compressed = false; // Stored as a block-compressed stream, see `FileAccessCompressed`.
 	};
 
 private:
@@ -112,7 +118,7 @@ private:
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_compressed = false); // for PackSource
 	void remove_path(const String &p_path);
 	uint8_t *get_file_hash(const String &p_path);
 	HashSet<String> get_file_paths() const;
@@ -143,9 +149,23 @@ public:
 };
 
 class PackedSourcePCK : public PackSource {
+	// Packs are mapped in memory when the platform supports it, so their files can be read without
+	// a file handle each and consumed in place through `FileAccess::get_mapped_span()`.
+	struct MappedPack {
+		const uint8_t *data = nullptr;
+		uint64_t length = 0;
+	};
+	HashMap<String, MappedPack> mapped_packs;
+	LocalVector<MappedPack> replaced_packs; // Files opened before a pack was loaded again may still use them.
+	Mutex mapped_packs_mutex;
+
+	void _map_pack(const String &p_path, const String &p_path_absolute);
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) override;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) override;
+
+	virtual ~PackedSourcePCK();
 };
 
 class FileAccessPack : public FileAccess {
@@ -156,6 +176,9 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+	const uint8_t *mapped_data = nullptr; // Start of the file in a mapped pack, instead of `f`.
+
+	void _open_compressed(Ref<FileAccess> p_base);
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual BitField<FileAccess::UnixPermissionFlags> _get_unix_permissions(const String &p_file) override { return 0; }
@@ -177,6 +200,8 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_mapped_span(uint64_t p_length) const override;
+	virtual void prefetch(uint64_t p_offset, uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -190,7 +215,7 @@ public:
 
 	virtual void close() override;
 
-	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file);
+	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const uint8_t *p_mapped_data = nullptr, uint64_t p_mapped_length = 0);
 };
 
 Ref<FileAccess> PackedData::try_open_path(const String &p_path) {
@@ -32,8 +32,9 @@
 
 #include "core/crypto/crypto_core.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
-#include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION, PACK_FORMAT_VERSION_UNCOMPRESSED
 #include "core/version.h"
 
 static int _get_pad(int p_alignment, int p_n) {
@@ -48,11 +49,15 @@ static int _get_pad(int p_alignment, int p_n) {
 
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_path", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
-	ClassDB::bind_method(D_METHOD("add_file", "target_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("add_file", "target_path", "source_path", "encrypt"), &PCKPacker::_add_file_bind, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file_removal", "target_path"), &PCKPacker::add_file_removal);
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 }
 
+Error PCKPacker::_add_file_bind(const String &p_target_path, const String &p_source_path, bool p_encrypt) {
+	return add_file(p_target_path, p_source_path, p_encrypt);
+}
+
 Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const String &p_key, bool p_encrypt_directory) {
 	ERR_FAIL_COND_V_MSG((p_key.is_empty() || !p_key.is_valid_hex_number(false) || p_key.length() != 64), ERR_CANT_CREATE, "Invalid Encryption Key (must be 64 characters long).");
 	ERR_FAIL_COND_V_MSG(p_alignment <= 0, ERR_CANT_CREATE, "Invalid alignment, must be greater then 0.");
@@ -90,7 +95,7 @@ Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const Stri
 	alignment = p_alignment;
 
 	file->store_32(PACK_HEADER_MAGIC);
-	file->store_32(PACK_FORMAT_VERSION);
+	file->store_32(PACK_FORMAT_VERSION_UNCOMPRESSED); // Raised in flush() if any file is compressed.
 	file->store_32(VERSION_MAJOR);
 	file->store_32(VERSION_MINOR);
 	file->store_32(VERSION_PATCH);
@@ -126,7 +131,7 @@ Error PCKPacker::add_file_removal(const String &p_target_path) {
 	return OK;
 }
 
-Error PCKPacker::add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt) {
+Error PCKPacker::add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt, bool p_compress) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
 	Ref<FileAccess> f = FileAccess::open(p_source_path, FileAccess::READ);
@@ -154,6 +159,12 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 	pf.encrypted = p_encrypt;
 
 	uint64_t _size = pf.size;
+	if (p_compress) {
+		// Compressed now so the offsets of the following files are known, and kept until flush.
+		pf.compressed_data = FileAccessCompressed::compress_buffer(data.ptr(), data.size());
+		ERR_FAIL_COND_V_MSG(pf.compressed_data.is_empty(), ERR_CANT_CREATE, vformat("Can't compress file '%s'.", p_source_path));
+		_size = pf.compressed_data.size();
+	}
 	if (p_encrypt) { // Add encryption overhead.
 		if (_size % 16) { // Pad to encryption block size.
 			_size += 16 - (_size % 16);
@@ -174,6 +185,16 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 Error PCKPacker::flush(bool p_verbose) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
+	for (int i = 0; i < files.size(); i++) {
+		if (!files[i].compressed_data.is_empty()) {
+			const uint64_t position = file->get_position();
+			file->seek(4); // After the magic.
+			file->store_32(PACK_FORMAT_VERSION);
+			file->seek(position);
+			break;
+		}
+	}
+
 	int64_t file_base_ofs = file->get_position();
 	file->store_64(0); // files base
 
@@ -218,6 +239,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].removal) {
 			flags |= PACK_FILE_REMOVAL;
 		}
+		if (!files[i].compressed_data.is_empty()) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -258,6 +282,10 @@ Error PCKPacker::flush(bool p_verbose) {
 			ftmp = fae;
 		}
 
+		if (!files[i].compressed_data.is_empty()) {
+			ftmp->store_buffer(files[i].compressed_data.ptr(), files[i].compressed_data.size());
+			to_write = 0;
+		}
 		while (to_write > 0) {
 			uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
 			ftmp->store_buffer(buf, read);
@@ -47,6 +47,8 @@ class PCKPacker : public RefCounted {
 
 	static void _bind_methods();
 
+	Error _add_file_bind(const String &p_target_path, const String &p_source_path, bool p_encrypt);
+
 	struct File {
 		String path;
 		String src_path;
@@ -55,12 +57,13 @@ class PCKPacker : public RefCounted {
 		bool encrypted = false;
 		bool removal = false;
 		Vector<uint8_t> md5;
+		Vector<uint8_t> compressed_data; // Block-compressed stream stored instead of the source file, if not empty.
 	};
 	Vector<File> files;
 
 public:
 	Error pck_start(const String &p_pck_path, int p_alignment = 32, const String &p_key = "0000000000000000000000000000000000000000000000000000000000000000", bool p_encrypt_directory = false);
-	Error add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt = false);
+	Error add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt = false, bool p_compress = false);
 	Error add_file_removal(const String &p_target_path);
 	Error flush(bool p_verbose = false);
 
@@ -163,6 +163,10 @@ StringName ResourceLoaderBinary::_get_string() {
 		if (len == 0) {
 			return StringName();
 		}
+		const char *span = (const char *)f->get_mapped_span(len);
+		if (span) {
+			return String::utf8(span, strnlen(span, len));
+		}
 		f->get_buffer((uint8_t *)&str_buf[0], len);
 		String s;
 		s.parse_utf8(&str_buf[0]);
@@ -933,6 +937,10 @@ String ResourceLoaderBinary::get_unicode_string() {
 	if (len == 0) {
 		return String();
 	}
+	const char *span = (const char *)f->get_mapped_span(len);
+	if (span) {
+		return String::utf8(span, strnlen(span, len));
+	}
 	f->get_buffer((uint8_t *)&str_buf[0], len);
 	String s;
 	s.parse_utf8(&str_buf[0]);
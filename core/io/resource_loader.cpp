@@ -367,6 +367,18 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 	}
 	// --
 
+	const bool profiling_stages = load_stage_profiling.is_set();
+	const uint64_t run_start_usec = profiling_stages ? OS::get_singleton()->get_ticks_usec() : 0;
+	load_task.wait_usec = 0;
+
+	LocalVector<Ref<LoadToken>> dependency_closure;
+	if (load_task.start_dependency_closure) {
+		_start_dependency_closure(load_task, dependency_closure);
+		if (profiling_stages) {
+			load_task.dependencies_usec = OS::get_singleton()->get_ticks_usec() - run_start_usec;
+		}
+	}
+
 	bool xl_remapped = false;
 	const String &remapped_path = _path_remap(load_task.local_path, &xl_remapped);
 
@@ -378,6 +390,26 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 		MessageQueue::get_singleton()->flush();
 	}
 
+	// A running load only keeps its token alive through a bare reference, so dropping the last Ref before it's done
+	// would leak the token, its task and its resource. The resource awaited the dependencies it used already.
+	for (const Ref<LoadToken> &token : dependency_closure) {
+		_load_complete(*token.ptr(), nullptr);
+	}
+	dependency_closure.clear();
+
+	if (profiling_stages) {
+		LoadStageTimes times;
+		times.path = load_task.local_path;
+		times.queued_usec = load_task.created_usec ? run_start_usec - load_task.created_usec : 0;
+		times.dependencies_usec = load_task.dependencies_usec;
+		times.wait_usec = load_task.wait_usec;
+		const uint64_t run_usec = OS::get_singleton()->get_ticks_usec() - run_start_usec;
+		times.load_usec = run_usec - MIN(run_usec, times.dependencies_usec + times.wait_usec);
+
+		MutexLock lock(load_stage_times_mutex);
+		load_stage_times.push_back(times);
+	}
+
 	if (res.is_null()) {
 		print_verbose("Failed loading resource: " + remapped_path);
 	}
@@ -497,6 +529,123 @@ static String _validate_local_path(const String &p_path) {
 	}
 }
 
+// Files of the closure are read ahead into the OS cache, so their loaders don't wait on the disk one after another.
+void ResourceLoader::_read_ahead(const String &p_path, uint64_t &r_budget) {
+	String path = import_remap(_path_remap(p_path));
+	Ref<FileAccess> file = FileAccess::open(path, FileAccess::READ);
+	if (file.is_null()) {
+		return;
+	}
+	uint64_t length = MIN(file->get_length(), r_budget);
+	if (length == 0) {
+		return;
+	}
+	file->prefetch(0, length);
+	r_budget -= length;
+}
+
+void ResourceLoader::_start_dependency_closure(const ThreadLoadTask &p_load_task, LocalVector<Ref<LoadToken>> &r_closure) {
+	struct Dependency {
+		String path;
+		String type;
+		LocalVector<uint32_t> dependencies;
+		uint32_t dependents = 0;
+	};
+
+	LocalVector<Dependency> nodes;
+	HashMap<String, uint32_t> node_indices;
+	nodes.push_back({ p_load_task.local_path, p_load_task.type_hint });
+	node_indices.insert(p_load_task.local_path, 0);
+
+	// Headers are read a level at a time, with each level spread across the pool.
+	LocalVector<uint32_t> level;
+	level.push_back(0);
+	while (!level.is_empty()) {
+		LocalVector<List<String>> level_dependencies;
+		level_dependencies.resize(level.size());
+		WorkerThreadPool::get_singleton()->parallel_for(0, level.size(), 1, [&](uint32_t i) {
+			get_dependencies(nodes[level[i]].path, &level_dependencies[i], true);
+		});
+
+		LocalVector<uint32_t> next_level;
+		for (uint32_t i = 0; i < level.size(); i++) {
+			for (const String &dependency : level_dependencies[i]) {
+				// Formatted as "path_or_uid::type::fallback_path".
+				Vector<String> parts = dependency.split("::");
+				String path = parts[0];
+				if (path.begins_with("uid://")) {
+					ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(path);
+					if (uid != ResourceUID::INVALID_ID && ResourceUID::get_singleton()->has_id(uid)) {
+						path = ResourceUID::get_singleton()->get_id_path(uid);
+					} else if (parts.size() > 2) {
+						path = parts[2];
+					} else {
+						continue;
+					}
+				}
+				path = _validate_local_path(path);
+				if (path.is_empty() || ResourceCache::has(path)) {
+					continue;
+				}
+
+				uint32_t index;
+				HashMap<String, uint32_t>::Iterator E = node_indices.find(path);
+				if (E) {
+					index = E->value;
+				} else {
+					index = nodes.size();
+					nodes.push_back({ path, parts.size() > 1 ? parts[1] : String() });
+					node_indices.insert(path, index);
+					// Scripts are parsed in full to find their dependencies, and load them on their own anyway.
+					if (nodes[index].type.is_empty() || !ClassDB::is_parent_class(nodes[index].type, "Script")) {
+						next_level.push_back(index);
+					}
+				}
+				nodes[level[i]].dependencies.push_back(index);
+				nodes[index].dependents++;
+			}
+		}
+		level = next_level;
+	}
+
+	// The pool only lets tasks await newer ones, so dependents are started before their dependencies.
+	LocalVector<uint32_t> order;
+	LocalVector<bool> ordered;
+	ordered.resize(nodes.size());
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		ordered[i] = false;
+	}
+	order.push_back(0);
+	ordered[0] = true;
+	for (uint32_t i = 0; i < order.size(); i++) {
+		for (uint32_t dependency : nodes[order[i]].dependencies) {
+			if (--nodes[dependency].dependents == 0 && !ordered[dependency]) {
+				order.push_back(dependency);
+				ordered[dependency] = true;
+			}
+		}
+	}
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		if (!ordered[i]) { // Part of a cycle, left to the regular cyclic load handling.
+			order.push_back(i);
+		}
+	}
+
+	// The hints are given in load order, so the files needed first tend to arrive first.
+	uint64_t read_ahead_budget = DEPENDENCY_READ_AHEAD_BUDGET;
+	for (uint32_t i = 0; i < order.size() && read_ahead_budget > 0; i++) {
+		_read_ahead(nodes[order[i]].path, read_ahead_budget);
+	}
+
+	for (uint32_t i = 1; i < order.size(); i++) {
+		const Dependency &dependency = nodes[order[i]];
+		Ref<LoadToken> token = _load_start(dependency.path, dependency.type, LOAD_THREAD_DISTRIBUTE, ResourceFormatLoader::CACHE_MODE_REUSE);
+		if (token.is_valid()) {
+			r_closure.push_back(token);
+		}
+	}
+}
+
 Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode) {
 	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode, true);
 	return token.is_valid() ? OK : FAILED;
@@ -596,6 +745,11 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			load_task.type_hint = p_type_hint;
 			load_task.cache_mode = p_cache_mode;
 			load_task.use_sub_threads = p_thread_mode == LOAD_THREAD_DISTRIBUTE;
+			// Deep cache modes have dependencies loaded apart from the cache, which can't be started up front.
+			load_task.start_dependency_closure = p_for_user && load_task.use_sub_threads && p_cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE_DEEP && p_cache_mode != ResourceFormatLoader::CACHE_MODE_REPLACE_DEEP;
+			if (load_stage_profiling.is_set()) {
+				load_task.created_usec = OS::get_singleton()->get_ticks_usec();
+			}
 			if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
 				Ref<Resource> existing = ResourceCache::get_ref(local_path);
 				if (existing.is_valid()) {
@@ -794,6 +948,7 @@ Ref<Resource> ResourceLoader::_load_complete_inner(LoadToken &p_load_token, Erro
 				return Ref<Resource>();
 			}
 
+			const uint64_t wait_start_usec = curr_load_task && load_stage_profiling.is_set() ? OS::get_singleton()->get_ticks_usec() : 0;
 			bool loader_is_wtp = load_task.task_id != 0;
 			if (loader_is_wtp) {
 				// Loading thread is in the worker pool.
@@ -836,6 +991,10 @@ Ref<Resource> ResourceLoader::_load_complete_inner(LoadToken &p_load_token, Erro
 
 				DEV_ASSERT(load_task.status == THREAD_LOAD_FAILED || load_task.status == THREAD_LOAD_LOADED);
 			}
+
+			if (wait_start_usec) {
+				curr_load_task->wait_usec += OS::get_singleton()->get_ticks_usec() - wait_start_usec;
+			}
 		}
 
 		if (cleaning_tasks) {
@@ -890,6 +1049,18 @@ Ref<Resource> ResourceLoader::_load_complete_inner(LoadToken &p_load_token, Erro
 	return resource;
 }
 
+void ResourceLoader::set_load_stage_profiling(bool p_enable) {
+	MutexLock lock(load_stage_times_mutex);
+	load_stage_times.clear();
+	load_stage_profiling.set_to(p_enable);
+}
+
+void ResourceLoader::take_load_stage_times(LocalVector<LoadStageTimes> &r_times) {
+	MutexLock lock(load_stage_times_mutex);
+	r_times = load_stage_times;
+	load_stage_times.clear();
+}
+
 bool ResourceLoader::_ensure_load_progress() {
 	// Some servers may need a new engine iteration to allow the load to progress.
 	// Since the only known one is the rendering server (in single thread mode), let's keep it simple and just sync it.
@@ -1232,8 +1403,9 @@ String ResourceLoader::_path_remap(const String &p_path, bool *r_translation_rem
 		}
 	}
 
-	if (path_remaps.has(new_path)) {
-		new_path = path_remaps[new_path];
+	const String *remapped_path = path_remaps.getptr(new_path);
+	if (remapped_path) {
+		new_path = *remapped_path;
 	} else {
 		// Try file remap.
 		// Usually, there's no remap file and FileAccess::exists() is faster than FileAccess::open().
@@ -1558,8 +1730,12 @@ bool ResourceLoader::cleaning_tasks = false;
 
 HashMap<String, ResourceLoader::LoadToken *> ResourceLoader::user_load_tokens;
 
+SafeFlag ResourceLoader::load_stage_profiling;
+Mutex ResourceLoader::load_stage_times_mutex;
+LocalVector<ResourceLoader::LoadStageTimes> ResourceLoader::load_stage_times;
+
 SelfList<Resource>::List ResourceLoader::remapped_list;
 HashMap<String, Vector<String>> ResourceLoader::translation_remaps;
-HashMap<String, String> ResourceLoader::path_remaps;
+SwissHashMap<String, String> ResourceLoader::path_remaps;
 
 ResourceLoaderImport ResourceLoader::import = nullptr;
@@ -36,6 +36,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
+#include "core/templates/swiss_hash_map.h"
 
 class ConditionVariable;
 
@@ -135,6 +136,7 @@ public:
 	};
 
 	static const int BINARY_MUTEX_TAG = 1;
+	static const uint64_t DEPENDENCY_READ_AHEAD_BUDGET = 64 * 1024 * 1024; // Bytes the OS is asked to read ahead for each threaded load.
 
 	static Ref<LoadToken> _load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, bool p_for_user = false);
 	static Ref<Resource> _load_complete(LoadToken &p_load_token, Error *r_error);
@@ -156,7 +158,7 @@ private:
 	static bool abort_on_missing_resource;
 	static bool create_missing_resources_if_class_unavailable;
 	static HashMap<String, Vector<String>> translation_remaps;
-	static HashMap<String, String> path_remaps;
+	static SwissHashMap<String, String> path_remaps; // Only looked up, never iterated.
 
 	static String _path_remap(const String &p_path, bool *r_translation_remapped = nullptr);
 	friend class Resource;
@@ -189,8 +191,14 @@ private:
 		Error error = OK;
 		Ref<Resource> resource;
 		bool use_sub_threads = false;
+		bool start_dependency_closure = false; // Set for distributed loads requested by the user.
 		HashSet<String> sub_tasks;
 
+		// Load stage timings, only tracked while they are being profiled.
+		uint64_t created_usec = 0;
+		uint64_t dependencies_usec = 0;
+		uint64_t wait_usec = 0;
+
 		struct ResourceChangedConnection {
 			Resource *source = nullptr;
 			Callable callable;
@@ -200,6 +208,8 @@ private:
 	};
 
 	static void _run_load_task(void *p_userdata);
+	static void _start_dependency_closure(const ThreadLoadTask &p_load_task, LocalVector<Ref<LoadToken>> &r_closure);
+	static void _read_ahead(const String &p_path, uint64_t &r_budget);
 
 	static thread_local int load_nesting;
 	static thread_local HashMap<int, HashMap<String, Ref<Resource>>> res_ref_overrides; // Outermost key is nesting level.
@@ -216,6 +226,21 @@ private:
 
 	static float _dependency_get_progress(const String &p_path);
 
+public:
+	// Time spent by a load task in each stage, in microseconds.
+	struct LoadStageTimes {
+		String path;
+		uint64_t queued_usec = 0; // Until a thread started running the task.
+		uint64_t dependencies_usec = 0; // Resolving and starting the dependency closure up front.
+		uint64_t load_usec = 0; // Reading, parsing and constructing the resource.
+		uint64_t wait_usec = 0; // Awaiting dependencies loaded by other tasks.
+	};
+
+private:
+	static SafeFlag load_stage_profiling;
+	static Mutex load_stage_times_mutex;
+	static LocalVector<LoadStageTimes> load_stage_times;
+
 	static bool _ensure_load_progress();
 
 public:
@@ -225,6 +250,9 @@ public:
 
 	static bool is_within_load() { return load_nesting > 0; }
 
+	static void set_load_stage_profiling(bool p_enable);
+	static void take_load_stage_times(LocalVector<LoadStageTimes> &r_times);
+
 	static void resource_changed_connect(Resource *p_source, const Callable &p_callable, uint32_t p_flags);
 	static void resource_changed_disconnect(Resource *p_source, const Callable &p_callable);
 	static void resource_changed_emit(Resource *p_source);
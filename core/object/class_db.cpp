@@ -1705,6 +1705,26 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 	return false;
 }
 
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+	ClassInfo *type = classes.getptr(p_class);
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg;
+		}
+
+		// Shadowed by what `get_property()` finds first.
+		if (check->constant_map.has(p_property) || check->method_map.has(p_property) || check->signal_map.has(p_property)) {
+			return nullptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 int ClassDB::get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -40,24 +40,10 @@
 #include "core/string/translation_server.h"
 #include "core/templates/local_vector.h"
 #include "core/variant/typed_array.h"
+#include "core/variant/variant_internal.h"
 
 #ifdef DEBUG_ENABLED
 
-struct _ObjectDebugLock {
-	ObjectID obj_id;
-
-	_ObjectDebugLock(Object *p_obj) {
-		obj_id = p_obj->get_instance_id();
-		p_obj->_lock_index.ref();
-	}
-	~_ObjectDebugLock() {
-		Object *obj_ptr = ObjectDB::get_instance(obj_id);
-		if (likely(obj_ptr)) {
-			obj_ptr->_lock_index.unref();
-		}
-	}
-};
-
 #define OBJ_DEBUG_LOCK _ObjectDebugLock _debug_lock(this);
 
 #else
@@ -385,14 +371,38 @@ Variant Object::get(const StringName &p_name, bool *r_valid) const {
 }
 
 void Object::set_indexed(const Vector<StringName> &p_names, const Variant &p_value, bool *r_valid) {
+	_set_indexed(nullptr, p_names, p_value, r_valid);
+}
+
+void Object::set_indexed(PropertyHandle &p_handle, const Vector<StringName> &p_names, const Variant &p_value, bool *r_valid) {
+	_set_indexed(&p_handle, p_names, p_value, r_valid);
+}
+
+Variant Object::get_indexed(const Vector<StringName> &p_names, bool *r_valid) const {
+	return _get_indexed(nullptr, p_names, r_valid);
+}
+
+Variant Object::get_indexed(PropertyHandle &p_handle, const Vector<StringName> &p_names, bool *r_valid) const {
+	return _get_indexed(&p_handle, p_names, r_valid);
+}
+
+void Object::_set_indexed(PropertyHandle *p_handle, const Vector<StringName> &p_names, const Variant &p_value, bool *r_valid) {
 	if (p_names.is_empty()) {
 		if (r_valid) {
 			*r_valid = false;
 		}
 		return;
 	}
+	if (p_handle && p_handle->name != p_names[0]) {
+		p_handle->name = p_names[0];
+		p_handle->reset();
+	}
 	if (p_names.size() == 1) {
-		set(p_names[0], p_value, r_valid);
+		if (p_handle) {
+			set_by_handle(*p_handle, p_value, r_valid);
+		} else {
+			set(p_names[0], p_value, r_valid);
+		}
 		return;
 	}
 
@@ -403,7 +413,7 @@ void Object::set_indexed(const Vector<StringName> &p_names, const Variant &p_val
 
 	List<Variant> value_stack;
 
-	value_stack.push_back(get(p_names[0], r_valid));
+	value_stack.push_back(p_handle ? get_by_handle(*p_handle, r_valid) : get(p_names[0], r_valid));
 
 	if (!*r_valid) {
 		value_stack.clear();
@@ -437,13 +447,17 @@ void Object::set_indexed(const Vector<StringName> &p_names, const Variant &p_val
 		}
 	}
 
-	set(p_names[0], value_stack.back()->get(), r_valid);
+	if (p_handle) {
+		set_by_handle(*p_handle, value_stack.back()->get(), r_valid);
+	} else {
+		set(p_names[0], value_stack.back()->get(), r_valid);
+	}
 	value_stack.pop_back();
 
 	ERR_FAIL_COND(!value_stack.is_empty());
 }
 
-Variant Object::get_indexed(const Vector<StringName> &p_names, bool *r_valid) const {
+Variant Object::_get_indexed(PropertyHandle *p_handle, const Vector<StringName> &p_names, bool *r_valid) const {
 	if (p_names.is_empty()) {
 		if (r_valid) {
 			*r_valid = false;
@@ -452,7 +466,16 @@ Variant Object::get_indexed(const Vector<StringName> &p_names, bool *r_valid) co
 	}
 	bool valid = false;
 
-	Variant current_value = get(p_names[0], &valid);
+	Variant current_value;
+	if (p_handle) {
+		if (p_handle->name != p_names[0]) {
+			p_handle->name = p_names[0];
+			p_handle->reset();
+		}
+		current_value = get_by_handle(*p_handle, &valid);
+	} else {
+		current_value = get(p_names[0], &valid);
+	}
 	for (int i = 1; i < p_names.size(); i++) {
 		current_value = current_value.get_named(p_names[i], valid);
 
@@ -467,6 +490,137 @@ Variant Object::get_indexed(const Vector<StringName> &p_names, bool *r_valid) co
 	return current_value;
 }
 
+void Object::resolve_property(PropertyHandle &r_handle) const {
+	r_handle.object = _instance_id;
+	r_handle.version = _property_handle_version;
+	r_handle.kind = PropertyHandle::KIND_GENERIC;
+	r_handle.script_member = -1;
+	r_handle.index = -1;
+	r_handle.setter = nullptr;
+	r_handle.getter = nullptr;
+
+	// Same precedence as `set()` and `get()`, anything that may intercept the name keeps the generic path.
+	if (script_instance) {
+		r_handle.script_member = script_instance->get_member_index(r_handle.name);
+		if (r_handle.script_member >= 0) {
+			r_handle.kind = PropertyHandle::KIND_SCRIPT_MEMBER;
+		}
+		return;
+	}
+
+	if (_extension && (_extension->set || _extension->get)) {
+		return;
+	}
+
+	// Extension bindings may be reloaded, their method binds can't be kept.
+	ClassDB::APIType api = ClassDB::get_api_type(get_class_name());
+	if (api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION) {
+		return;
+	}
+
+	const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(get_class_name(), r_handle.name);
+	if (!psg) {
+		return;
+	}
+	if (psg->setter) {
+		r_handle.setter = psg->_setptr;
+	}
+	if (psg->getter) {
+		r_handle.getter = psg->_getptr;
+	}
+	if (r_handle.setter || r_handle.getter) {
+		r_handle.kind = PropertyHandle::KIND_NATIVE;
+		r_handle.index = psg->index;
+	}
+}
+
+void Object::set_by_handle(PropertyHandle &p_handle, const Variant &p_value, bool *r_valid) {
+	if (unlikely(p_handle.object != _instance_id || p_handle.version != _property_handle_version || p_handle.kind == PropertyHandle::KIND_UNRESOLVED)) {
+		resolve_property(p_handle);
+	}
+
+	switch (p_handle.kind) {
+		case PropertyHandle::KIND_SCRIPT_MEMBER: {
+			// Values that need a conversion are left to the script's own `set()`.
+			if (script_instance->set_member(p_handle.script_member, p_value)) {
+#ifdef TOOLS_ENABLED
+				_edited = true;
+#endif
+				if (r_valid) {
+					*r_valid = true;
+				}
+				return;
+			}
+		} break;
+		case PropertyHandle::KIND_NATIVE: {
+			if (!p_handle.setter) {
+				break;
+			}
+#ifdef TOOLS_ENABLED
+			_edited = true;
+#endif
+			Callable::CallError ce;
+			if (p_handle.index >= 0) {
+				Variant index = p_handle.index;
+				const Variant *args[2] = { &index, &p_value };
+				p_handle.setter->call(this, args, 2, ce);
+			} else {
+				const Variant *args[1] = { &p_value };
+				p_handle.setter->call(this, args, 1, ce);
+			}
+			if (r_valid) {
+				*r_valid = ce.error == Callable::CallError::CALL_OK;
+			}
+			return;
+		}
+		default:
+			break;
+	}
+
+	set(p_handle.name, p_value, r_valid);
+}
+
+Variant Object::get_by_handle(PropertyHandle &p_handle, bool *r_valid) const {
+	if (unlikely(p_handle.object != _instance_id || p_handle.version != _property_handle_version || p_handle.kind == PropertyHandle::KIND_UNRESOLVED)) {
+		resolve_property(p_handle);
+	}
+
+	switch (p_handle.kind) {
+		case PropertyHandle::KIND_SCRIPT_MEMBER: {
+			Variant ret;
+			if (script_instance->get_member(p_handle.script_member, ret)) {
+				if (r_valid) {
+					*r_valid = true;
+				}
+				return ret;
+			}
+		} break;
+		case PropertyHandle::KIND_NATIVE: {
+			if (!p_handle.getter) {
+				break;
+			}
+			Callable::CallError ce;
+			Variant ret;
+			if (p_handle.index >= 0) {
+				Variant index = p_handle.index;
+				const Variant *args[1] = { &index };
+				ret = p_handle.getter->call(const_cast<Object *>(this), args, 1, ce);
+			} else {
+				ret = p_handle.getter->call(const_cast<Object *>(this), nullptr, 0, ce);
+			}
+			// Matches `get()`, which reports the property as valid even if the getter failed.
+			if (r_valid) {
+				*r_valid = true;
+			}
+			return ce.error == Callable::CallError::CALL_OK ? ret : Variant();
+		}
+		default:
+			break;
+	}
+
+	return get(p_handle.name, r_valid);
+}
+
 void Object::get_property_list(List<PropertyInfo> *p_list, bool p_reversed) const {
 	if (script_instance && p_reversed) {
 		script_instance->get_property_list(p_list);
@@ -939,6 +1093,7 @@ void Object::set_script(const Variant &p_script) {
 		memdelete(script_instance);
 		script_instance = nullptr;
 	}
+	_property_handle_version++;
 
 	if (!s.is_null()) {
 		if (s->can_instantiate()) {
@@ -964,6 +1119,7 @@ void Object::set_script_instance(ScriptInstance *p_instance) {
 	}
 
 	script_instance = p_instance;
+	_property_handle_version++;
 
 	if (p_instance) {
 		script = p_instance->get_script();
@@ -1127,6 +1283,82 @@ Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::Cal
 	return emit_signalp(signal, args, argc);
 }
 
+// Finds the native method a signal connection calls, so emitting doesn't have to look it up by name.
+// Returns false if the target isn't ready to be resolved yet.
+static bool _resolve_slot_method_bind(const Callable &p_callable, MethodBind *&r_method_bind) {
+	r_method_bind = nullptr;
+	if (p_callable.is_custom()) {
+		return true;
+	}
+	Object *target = p_callable.get_object();
+	if (!target) {
+		return true;
+	}
+	const StringName class_name = target->get_class_name();
+	if (!ClassDB::class_exists(class_name)) {
+		// Most likely the object is not initialized yet.
+		return false;
+	}
+	// Methods of extension classes are freed when the extension is reloaded, don't keep them around.
+	const ClassDB::APIType api = ClassDB::get_api_type(class_name);
+	if (api == ClassDB::API_CORE || api == ClassDB::API_EDITOR) {
+		r_method_bind = ClassDB::get_method(class_name, p_callable.get_method());
+	}
+	return true;
+}
+
+// Same as calling the method through `Object::callp()` for a target without script, but skips the lookup by name,
+// and converting the arguments when they already have the types the method takes.
+static void _call_slot_method_bind(Object *p_target, MethodBind *p_method_bind, const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
+#ifdef DEBUG_ENABLED
+	_ObjectDebugLock debug_lock(p_target);
+#endif
+
+	if (!p_method_bind->is_vararg() && p_argcount == p_method_bind->get_argument_count()) {
+		bool validated = true;
+		for (int i = 0; i < p_argcount; i++) {
+			const Variant::Type type = p_method_bind->get_argument_type(i);
+			// Validated calls don't check the class of objects.
+			if (type == Variant::OBJECT || (type != Variant::NIL && p_args[i]->get_type() != type)) {
+				validated = false;
+				break;
+			}
+		}
+		if (validated) {
+			Variant ret;
+			if (p_method_bind->has_return()) {
+				VariantInternal::initialize(&ret, p_method_bind->get_argument_type(-1));
+			}
+			p_method_bind->validated_call(p_target, p_args, &ret);
+			r_error.error = Callable::CallError::CALL_OK;
+			return;
+		}
+	}
+
+	p_method_bind->call(p_target, p_args, p_argcount, r_error);
+}
+
+void Object::SignalData::update_emit_slots() {
+	Vector<EmitSlot> slots;
+	slots.resize(slot_map.size());
+	EmitSlot *w = slots.ptrw();
+	bool resolved = true;
+	for (KeyValue<Callable, Slot> &slot_kv : slot_map) {
+		Slot &slot = slot_kv.value;
+		if (unlikely(!slot.method_bind_resolved)) {
+			slot.method_bind_resolved = _resolve_slot_method_bind(slot.conn.callable, slot.method_bind);
+			resolved = resolved && slot.method_bind_resolved;
+		}
+		w->callable = slot.conn.callable;
+		w->flags = slot.conn.flags;
+		w->method_bind = slot.method_bind;
+		w++;
+	}
+	emit_slots = slots;
+	// Try again next time for targets that couldn't be resolved yet.
+	emit_slots_dirty = !resolved;
+}
+
 Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
@@ -1147,31 +1379,27 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
 	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
-	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	Callable *slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-	uint32_t *slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-	uint32_t slot_count = 0;
-
-	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-		memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-		slot_flags[slot_count] = slot_kv.value.conn.flags;
-		++slot_count;
+	if (unlikely(s->emit_slots_dirty)) {
+		s->update_emit_slots();
 	}
 
-	DEV_ASSERT(slot_count == s->slot_map.size());
+	// Ensure that disconnecting the signal or even deleting the object
+	// will not affect the signal calling. Copying only takes a reference.
+	const Vector<SignalData::EmitSlot> emit_slots = s->emit_slots;
+	const SignalData::EmitSlot *slots = emit_slots.ptr();
+	const int slot_count = emit_slots.size();
 
 	// Disconnect all one-shot connections before emitting to prevent recursion.
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+	for (int i = 0; i < slot_count; ++i) {
+		bool disconnect = slots[i].flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-		if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+		if (disconnect && (slots[i].flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
 			// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
 			disconnect = false;
 		}
 #endif
 		if (disconnect) {
-			_disconnect(p_name, slot_callables[i]);
+			_disconnect(p_name, slots[i].callable);
 		}
 	}
 
@@ -1179,9 +1407,9 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	Error err = OK;
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+	for (int i = 0; i < slot_count; ++i) {
+		const Callable &callable = slots[i].callable;
+		const uint32_t &flags = slots[i].flags;
 
 		if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
@@ -1196,8 +1424,14 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		} else {
 			Callable::CallError ce;
 			_emitting = true;
-			Variant ret;
-			callable.callp(args, argc, ret, ce);
+			// Scripts can override native methods, so only call the method directly on targets without one.
+			Object *target = slots[i].method_bind ? callable.get_object() : nullptr;
+			if (target && !target->get_script_instance()) {
+				_call_slot_method_bind(target, slots[i].method_bind, args, argc, ce);
+			} else {
+				Variant ret;
+				callable.callp(args, argc, ret, ce);
+			}
 			_emitting = false;
 
 			if (ce.error != Callable::CallError::CALL_OK) {
@@ -1217,10 +1451,6 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
-	}
-
 	return err;
 }
 
@@ -1434,6 +1664,8 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->emit_slots = Vector<SignalData::EmitSlot>(); // An emission in progress keeps its own copy.
+	s->emit_slots_dirty = true;
 
 	return OK;
 }
@@ -1509,6 +1741,9 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	// Released now, not at the next emission, as the slot may hold bound arguments alive.
+	s->emit_slots = Vector<SignalData::EmitSlot>();
+	s->emit_slots_dirty = true;
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
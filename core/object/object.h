@@ -562,6 +562,34 @@ private:
 
 class ScriptInstance;
 
+// Remembers how a property of an object was resolved, so it can be set and read
+// repeatedly without the name lookups done by `Object::set()` and `Object::get()`.
+// A handle is tied to the last object it was used with and resolves again when used
+// with another object, or after that object's script changed.
+struct PropertyHandle {
+	enum Kind {
+		KIND_UNRESOLVED,
+		KIND_GENERIC, // Goes through `Object::set()` and `Object::get()`.
+		KIND_SCRIPT_MEMBER,
+		KIND_NATIVE,
+	};
+
+	StringName name;
+	Kind kind = KIND_UNRESOLVED;
+	ObjectID object;
+	uint32_t version = 0;
+	int script_member = -1;
+	int index = -1; // Argument of indexed native setters and getters.
+	MethodBind *setter = nullptr;
+	MethodBind *getter = nullptr;
+
+	void reset() { kind = KIND_UNRESOLVED; }
+
+	PropertyHandle() {}
+	PropertyHandle(const StringName &p_name) :
+			name(p_name) {}
+};
+
 class Object {
 public:
 	typedef Object self_type;
@@ -602,11 +630,26 @@ private:
 			int reference_count = 0;
 			Connection conn;
 			List<Connection>::Element *cE = nullptr;
+			// Native method the connection calls, looked up on first emission.
+			MethodBind *method_bind = nullptr;
+			bool method_bind_resolved = false;
+		};
+
+		struct EmitSlot {
+			Callable callable;
+			uint32_t flags = 0;
+			MethodBind *method_bind = nullptr;
 		};
 
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		// The slots as emitted, rebuilt after connections change. An emission holds its own reference,
+		// so connecting or disconnecting from a callback only affects later emissions.
+		Vector<EmitSlot> emit_slots;
+		bool emit_slots_dirty = true;
 		bool removable = false;
+
+		void update_emit_slots();
 	};
 
 	HashMap<StringName, SignalData> signal_map;
@@ -628,6 +671,7 @@ private:
 	HashSet<String> editor_section_folding;
 #endif
 	ScriptInstance *script_instance = nullptr;
+	uint32_t _property_handle_version = 0;
 	Variant script; // Reference does not exist yet, store it in a Variant.
 	HashMap<StringName, Variant> metadata;
 	HashMap<StringName, Variant *> metadata_properties;
@@ -642,6 +686,8 @@ private:
 	TypedArray<Dictionary> _get_incoming_connections() const;
 	void _set_bind(const StringName &p_set, const Variant &p_value);
 	Variant _get_bind(const StringName &p_name) const;
+	void _set_indexed(PropertyHandle *p_handle, const Vector<StringName> &p_names, const Variant &p_value, bool *r_valid);
+	Variant _get_indexed(PropertyHandle *p_handle, const Vector<StringName> &p_names, bool *r_valid) const;
 	void _set_indexed_bind(const NodePath &p_name, const Variant &p_value);
 	Variant _get_indexed_bind(const NodePath &p_name) const;
 	int _get_method_argument_count_bind(const StringName &p_name) const;
@@ -845,6 +891,14 @@ public:
 	void set_indexed(const Vector<StringName> &p_names, const Variant &p_value, bool *r_valid = nullptr);
 	Variant get_indexed(const Vector<StringName> &p_names, bool *r_valid = nullptr) const;
 
+	void resolve_property(PropertyHandle &r_handle) const;
+	void set_by_handle(PropertyHandle &p_handle, const Variant &p_value, bool *r_valid = nullptr);
+	Variant get_by_handle(PropertyHandle &p_handle, bool *r_valid = nullptr) const;
+	// Same as above, with `p_handle` caching the access to the first name.
+	void set_indexed(PropertyHandle &p_handle, const Vector<StringName> &p_names, const Variant &p_value, bool *r_valid = nullptr);
+	Variant get_indexed(PropertyHandle &p_handle, const Vector<StringName> &p_names, bool *r_valid = nullptr) const;
+	_FORCE_INLINE_ void invalidate_property_handles() { _property_handle_version++; }
+
 	void get_property_list(List<PropertyInfo> *p_list, bool p_reversed = false) const;
 	void validate_property(PropertyInfo &p_property) const;
 	bool property_can_revert(const StringName &p_name) const;
@@ -1053,4 +1107,24 @@ public:
 	static int get_object_count();
 };
 
+#ifdef DEBUG_ENABLED
+
+// Held while calling a method on an object, so the object reports an error instead of being freed during the call.
+struct _ObjectDebugLock {
+	ObjectID obj_id;
+
+	_ObjectDebugLock(Object *p_obj) {
+		obj_id = p_obj->get_instance_id();
+		p_obj->_lock_index.ref();
+	}
+	~_ObjectDebugLock() {
+		Object *obj_ptr = ObjectDB::get_instance(obj_id);
+		if (likely(obj_ptr)) {
+			obj_ptr->_lock_index.unref();
+		}
+	}
+};
+
+#endif // DEBUG_ENABLED
+
 #endif // OBJECT_H
@@ -47,6 +47,11 @@ public:
 	virtual bool property_can_revert(const StringName &p_name) const = 0;
 	virtual bool property_get_revert(const StringName &p_name, Variant &r_ret) const = 0;
 
+	// Direct access to members, used by `PropertyHandle`. Returns -1 for members that must go through `set()` and `get()`.
+	virtual int get_member_index(const StringName &p_name) const { return -1; }
+	virtual bool set_member(int p_index, const Variant &p_value) { return false; }
+	virtual bool get_member(int p_index, Variant &r_ret) const { return false; }
+
 	virtual Object *get_owner() { return nullptr; }
 	virtual void get_property_state(List<Pair<StringName, Variant>> &state);
 
@@ -50,6 +50,52 @@ WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 thread_local WorkerThreadPool::UnlockableLocks WorkerThreadPool::unlockable_locks[MAX_UNLOCKABLE_LOCKS];
 #endif
 
+bool WorkerThreadPool::WorkQueue::push(Task *p_task) {
+	int64_t b = bottom.load(std::memory_order_relaxed);
+	int64_t t = top.load(std::memory_order_acquire);
+	if (b - t >= (int64_t)SIZE) {
+		return false;
+	}
+	buffer[b & MASK].store(p_task, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	bottom.store(b + 1, std::memory_order_relaxed);
+	return true;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::WorkQueue::pop() {
+	int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+	bottom.store(b, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t t = top.load(std::memory_order_relaxed);
+	if (t > b) {
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return nullptr;
+	}
+	Task *task = buffer[b & MASK].load(std::memory_order_relaxed);
+	if (t == b) {
+		// Last one left, so stealers may be racing for it.
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+			task = nullptr;
+		}
+		bottom.store(b + 1, std::memory_order_relaxed);
+	}
+	return task;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::WorkQueue::steal() {
+	int64_t t = top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t b = bottom.load(std::memory_order_acquire);
+	if (t >= b) {
+		return nullptr;
+	}
+	Task *task = buffer[t & MASK].load(std::memory_order_relaxed);
+	if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+		return nullptr; // Lost the race against the owner or another stealer.
+	}
+	return task;
+}
+
 void WorkerThreadPool::_process_task(Task *p_task) {
 #ifdef THREADS_ENABLED
 	int pool_thread_index = thread_ids[Thread::get_caller_id()];
@@ -70,14 +116,15 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		// about to be run uses scripting, guarantees are held.
 		ScriptServer::thread_enter();
 
-		task_mutex.lock();
-		p_task->pool_thread_index = pool_thread_index;
-		prev_task = curr_thread.current_task;
-		curr_thread.current_task = p_task;
-		if (p_task->pending_notify_yield_over) {
+		// No need for the task mutex here. notify_yield_over() checks the index again after setting the flag,
+		// so one of both sides sees the other.
+		p_task->pool_thread_index.store(pool_thread_index);
+		prev_task = curr_thread.current_task.load(std::memory_order_relaxed);
+		curr_thread.current_task.store(p_task, std::memory_order_relaxed);
+		if (unlikely(p_task->pending_notify_yield_over.load())) {
+			MutexLock task_lock(task_mutex);
 			curr_thread.yield_is_over = true;
 		}
-		task_mutex.unlock();
 	}
 #endif
 
@@ -129,8 +176,6 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		}
 
 		// For groups, tasks get rid of themselves.
-
-		task_mutex.lock();
 		task_allocator.free(p_task);
 	} else {
 		if (p_task->native_func) {
@@ -142,35 +187,25 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->callable.call();
 		}
 
-		task_mutex.lock();
-		p_task->completed = true;
-		p_task->pool_thread_index = -1;
-		if (p_task->waiting_user) {
-			p_task->done_semaphore.post(p_task->waiting_user);
-		}
-		// Let awaiters know.
-		for (uint32_t i = 0; i < threads.size(); i++) {
-			if (threads[i].awaited_task == p_task) {
-				threads[i].cond_var.notify_one();
-				threads[i].signaled = true;
-			}
+		if (p_task->self == INVALID_TASK_ID) {
+			// Task graph nodes can't be awaited individually, so they get rid of themselves.
+			task_allocator.free(p_task);
+		} else {
+			_complete_task(p_task);
 		}
 	}
 
 #ifdef THREADS_ENABLED
-	{
-		curr_thread.current_task = prev_task;
-		if (low_priority) {
-			low_priority_threads_used--;
-
-			if (_try_promote_low_priority_task()) {
-				if (prev_task) { // Otherwise, this thread will catch it.
-					_notify_threads(&curr_thread, 1, 0);
-				}
+	curr_thread.current_task.store(prev_task, std::memory_order_relaxed);
+	if (low_priority) {
+		MutexLock task_lock(task_mutex);
+		low_priority_threads_used--;
+
+		if (_try_promote_low_priority_task()) {
+			if (prev_task) { // Otherwise, this thread will catch it.
+				_notify_threads(&curr_thread, 1, 0);
 			}
 		}
-
-		task_mutex.unlock();
 	}
 
 	set_current_thread_safe_for_nodes(safe_for_nodes_backup);
@@ -178,12 +213,73 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 #endif
 }
 
+WorkerThreadPool::Task *WorkerThreadPool::_steal_task(ThreadData *p_thread_data) {
+	uint32_t thread_count = threads.size();
+
+	// Start at a random victim, so stealers don't all hammer the same deque.
+	uint32_t seed = p_thread_data->steal_seed;
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	p_thread_data->steal_seed = seed;
+
+	for (uint32_t i = 0; i < thread_count; i++) {
+		uint32_t victim = (seed + i) % thread_count;
+		if (victim == p_thread_data->index) {
+			continue;
+		}
+		Task *task = threads[victim].work_queue.steal();
+		if (task) {
+			return task;
+		}
+	}
+	return nullptr;
+}
+
+bool WorkerThreadPool::_has_stealable_tasks() const {
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		if (!threads[i].work_queue.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Only takes the task mutex if someone is already waiting. Otherwise, whoever waits later sees the state.
+void WorkerThreadPool::_complete_task(Task *p_task) {
+	p_task->pool_thread_index.store(-1);
+	// Once completed, a waiter may free the task, so it can't be touched after this unless it was awaited.
+	if (p_task->state.fetch_or(Task::STATE_COMPLETED, std::memory_order_acq_rel) & Task::STATE_AWAITED) {
+		MutexLock task_lock(task_mutex);
+		_notify_task_completed(p_task);
+	}
+}
+
+void WorkerThreadPool::_notify_task_completed(Task *p_task) {
+	p_task->completed = true;
+	if (p_task->waiting_user) {
+		p_task->done_semaphore.post(p_task->waiting_user);
+	}
+	// Let awaiters know.
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		if (threads[i].awaited_task == p_task) {
+			threads[i].cond_var.notify_one();
+			threads[i].signaled = true;
+		}
+	}
+}
+
 void WorkerThreadPool::_thread_function(void *p_user) {
 	ThreadData *thread_data = (ThreadData *)p_user;
 
 	while (true) {
-		Task *task_to_process = nullptr;
-		{
+		// Fast path: own deque first, then other threads' ones, without taking the task mutex.
+		Task *task_to_process = thread_data->work_queue.pop();
+		if (!task_to_process) {
+			task_to_process = singleton->_steal_task(thread_data);
+		}
+
+		if (!task_to_process) {
 			MutexLock lock(singleton->task_mutex);
 
 			bool exit = singleton->_handle_runlevel(thread_data, lock);
@@ -196,7 +292,8 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 			if (singleton->task_queue.first()) {
 				task_to_process = singleton->task_queue.first()->self();
 				singleton->task_queue.remove(singleton->task_queue.first());
-			} else {
+			} else if (!singleton->_has_stealable_tasks()) {
+				// Deques are only pushed to under the task mutex, so nothing can be missed between this check and the wait.
 				thread_data->cond_var.wait(lock);
 			}
 		}
@@ -233,7 +330,10 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
+			// Tasks spawned from a pool thread stay in its own deque, where it or idle threads will pick them up.
+			if (!caller_pool_thread || !caller_pool_thread->work_queue.push(p_tasks[i])) {
+				task_queue.add_last(&p_tasks[i]->task_elem);
+			}
 			if (!p_high_priority) {
 				low_priority_threads_used++;
 			}
@@ -272,9 +372,10 @@ void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data,
 		if (th.signaled) {
 			continue;
 		}
-		if (th.current_task) {
+		if (th.current_task.load(std::memory_order_relaxed)) {
 			// Good thread for promoting low-prio?
-			if (to_promote && th.awaited_task && th.current_task->low_priority) {
+			// Its current task is only looked into while it's awaiting, which means it's parked in it.
+			if (to_promote && th.awaited_task && th.current_task.load(std::memory_order_relaxed)->low_priority) {
 				if (likely(&th != p_current_thread_data)) {
 					th.cond_var.notify_one();
 				}
@@ -351,6 +452,129 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bo
 	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description);
 }
 
+WorkerThreadPool::TaskGraph::NodeID WorkerThreadPool::TaskGraph::add_native_task(void (*p_func)(void *), void *p_userdata) {
+	NodeID id = nodes.size();
+	nodes.push_back(Node());
+	nodes[id].native_func = p_func;
+	nodes[id].native_func_userdata = p_userdata;
+	return id;
+}
+
+void WorkerThreadPool::TaskGraph::add_dependency(NodeID p_predecessor, NodeID p_successor) {
+	ERR_FAIL_COND_MSG(pending_predecessors, "Can't add dependencies to a task graph that has already been started.");
+	ERR_FAIL_UNSIGNED_INDEX(p_successor, nodes.size());
+	ERR_FAIL_COND_MSG(p_predecessor >= p_successor, "A task can only depend on tasks added before it.");
+	nodes[p_predecessor].successors.push_back(p_successor);
+	nodes[p_successor].predecessor_count++;
+}
+
+WorkerThreadPool::TaskGraph::~TaskGraph() {
+	for (Node &node : nodes) {
+		if (node.template_userdata) { // Never run.
+			memdelete(node.template_userdata);
+		}
+	}
+	if (pending_predecessors) {
+		memdelete_arr(pending_predecessors);
+	}
+}
+
+void WorkerThreadPool::TaskGraphNodeUserData::callback() {
+	singleton->_run_task_graph_node(graph, node);
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_alloc_task_graph_node_task(TaskGraph *p_graph, uint32_t p_node) {
+	TaskGraphNodeUserData *ud = memnew(TaskGraphNodeUserData);
+	ud->graph = p_graph;
+	ud->node = p_node;
+
+	Task *task = task_allocator.alloc();
+	task->template_userdata = ud;
+	task->description = p_graph->description;
+	// No task ID is used.
+	return task;
+}
+
+void WorkerThreadPool::_run_task_graph_node(TaskGraph *p_graph, uint32_t p_node) {
+	TaskGraph::Node &node = p_graph->nodes[p_node];
+	if (node.native_func) {
+		node.native_func(node.native_func_userdata);
+	} else if (node.template_userdata) {
+		node.template_userdata->callback();
+		memdelete(node.template_userdata);
+		node.template_userdata = nullptr;
+	}
+
+	// Start the continuations this task was the last pending predecessor of.
+	uint32_t *ready_nodes = (uint32_t *)alloca(sizeof(uint32_t) * MAX(1u, node.successors.size()));
+	uint32_t ready_count = 0;
+	for (uint32_t successor : node.successors) {
+		if (p_graph->pending_predecessors[successor].decrement() == 0) {
+			ready_nodes[ready_count++] = successor;
+		}
+	}
+	if (ready_count) {
+		MutexLock<BinaryMutex> lock(task_mutex);
+		Task **tasks_posted = (Task **)alloca(sizeof(Task *) * ready_count);
+		for (uint32_t i = 0; i < ready_count; i++) {
+			tasks_posted[i] = _alloc_task_graph_node_task(p_graph, ready_nodes[i]);
+		}
+		_post_tasks(tasks_posted, ready_count, p_graph->high_priority, lock);
+	}
+
+	// The graph may be gone as soon as the last task is accounted for.
+	Task *completion_task = p_graph->completion_task;
+	if (p_graph->remaining_nodes.decrement() == 0) {
+		_complete_task(completion_task);
+	}
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::add_task_graph(TaskGraph *p_graph, bool p_high_priority, const String &p_description) {
+	ERR_FAIL_NULL_V(p_graph, INVALID_TASK_ID);
+	ERR_FAIL_COND_V_MSG(p_graph->pending_predecessors, INVALID_TASK_ID, "Task graph has already been started.");
+
+	uint32_t node_count = p_graph->nodes.size();
+	p_graph->pending_predecessors = memnew_arr(SafeNumeric<uint32_t>, MAX(1u, node_count));
+	uint32_t root_count = 0;
+	for (uint32_t i = 0; i < node_count; i++) {
+		p_graph->pending_predecessors[i].set(p_graph->nodes[i].predecessor_count);
+		if (p_graph->nodes[i].predecessor_count == 0) {
+			root_count++;
+		}
+	}
+	p_graph->remaining_nodes.set(node_count);
+	p_graph->high_priority = p_high_priority;
+	p_graph->description = p_description;
+
+	MutexLock<BinaryMutex> lock(task_mutex);
+
+	// This one is never posted. It stands for the whole graph, so it can be awaited like any other task.
+	Task *completion_task = task_allocator.alloc();
+	TaskID id = last_task++;
+	completion_task->self = id;
+	completion_task->description = p_description;
+	tasks.insert(id, completion_task);
+	p_graph->completion_task = completion_task;
+
+	if (node_count == 0) {
+		completion_task->state.store(Task::STATE_COMPLETED);
+		completion_task->completed = true;
+		return id;
+	}
+
+	Task **tasks_posted = (Task **)alloca(sizeof(Task *) * root_count);
+	uint32_t posted_count = 0;
+	for (uint32_t i = 0; i < node_count; i++) {
+		if (p_graph->nodes[i].predecessor_count == 0) {
+			tasks_posted[posted_count++] = _alloc_task_graph_node_task(p_graph, i);
+		}
+	}
+
+	_post_tasks(tasks_posted, root_count, p_high_priority, lock);
+
+	return id;
+}
+
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	MutexLock task_lock(task_mutex);
 	const Task *const *taskp = tasks.getptr(p_task_id);
@@ -358,7 +582,7 @@ bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 		ERR_FAIL_V_MSG(false, "Invalid Task ID"); // Invalid task
 	}
 
-	return (*taskp)->completed;
+	return (*taskp)->is_completed();
 }
 
 Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
@@ -370,7 +594,8 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	}
 	Task *task = *taskp;
 
-	if (task->completed) {
+	// Waiters registered before completion keep the task alive until they have been notified.
+	if (task->is_completed()) {
 		if (task->waiting_pool == 0 && task->waiting_user == 0) {
 			tasks.erase(p_task_id);
 			task_allocator.free(task);
@@ -380,7 +605,7 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	}
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
-	if (caller_pool_thread && p_task_id <= caller_pool_thread->current_task->self) {
+	if (caller_pool_thread && p_task_id <= caller_pool_thread->current_task.load(std::memory_order_relaxed)->self) {
 		// Deadlock prevention:
 		// When a pool thread wants to wait for an older task, the following situations can happen:
 		// 1. Awaited task is deep in the stack of the awaiter.
@@ -396,6 +621,16 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 		return ERR_BUSY;
 	}
 
+	if (task->state.fetch_or(Task::STATE_AWAITED, std::memory_order_acq_rel) & Task::STATE_COMPLETED) {
+		// Completed in the meantime, before seeing this waiter.
+		if (task->waiting_pool == 0 && task->waiting_user == 0) {
+			tasks.erase(p_task_id);
+			task_allocator.free(task);
+		}
+		task_mutex.unlock();
+		return OK;
+	}
+
 	if (caller_pool_thread) {
 		task->waiting_pool++;
 	} else {
@@ -479,8 +714,8 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
-					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || !p_caller_pool_thread->work_queue.is_empty()) ? 1 : 0;
+					uint32_t to_promote = p_caller_pool_thread->current_task.load(std::memory_order_relaxed)->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
 						p_caller_pool_thread->signaled = true;
@@ -491,18 +726,23 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				break;
 			}
 
-			if (p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first()) {
+			if (p_caller_pool_thread->current_task.load(std::memory_order_relaxed)->low_priority && low_priority_task_queue.first()) {
 				if (_try_promote_low_priority_task()) {
 					_notify_threads(p_caller_pool_thread, 1, 0);
 				}
 			}
 
-			if (singleton->task_queue.first()) {
+			// Own deque first, since it most likely holds the work being awaited.
+			task_to_process = p_caller_pool_thread->work_queue.pop();
+			if (!task_to_process && task_queue.first()) {
 				task_to_process = task_queue.first()->self();
 				task_queue.remove(task_queue.first());
 			}
-
 			if (!task_to_process) {
+				task_to_process = _steal_task(p_caller_pool_thread);
+			}
+
+			if (!task_to_process && !_has_stealable_tasks()) {
 				p_caller_pool_thread->awaited_task = p_task;
 
 				_unlock_unlockable_mutexes();
@@ -543,7 +783,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!task_queue.first() && !low_priority_task_queue.first() && !_has_stealable_tasks()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -592,15 +832,21 @@ void WorkerThreadPool::notify_yield_over(TaskID p_task_id) {
 		ERR_FAIL_MSG("Invalid Task ID.");
 	}
 	Task *task = *taskp;
-	if (task->pool_thread_index == -1) { // Completed or not started yet.
-		if (!task->completed) {
-			// This avoids a race condition where a task is created and yield-over called before it's processed.
-			task->pending_notify_yield_over = true;
+	int pool_thread_index = task->pool_thread_index.load();
+	if (pool_thread_index == -1) { // Completed or not started yet.
+		if (task->is_completed()) {
+			return;
+		}
+		// This avoids a race condition where a task is created and yield-over called before it's processed.
+		task->pending_notify_yield_over.store(true);
+		// It may have started meanwhile, without seeing the flag.
+		pool_thread_index = task->pool_thread_index.load();
+		if (pool_thread_index == -1) {
+			return;
 		}
-		return;
 	}
 
-	ThreadData &td = threads[task->pool_thread_index];
+	ThreadData &td = threads[pool_thread_index];
 	td.yield_is_over = true;
 	td.signaled = true;
 	td.cond_var.notify_one();
@@ -661,6 +907,65 @@ WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_act
 	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
 }
 
+void WorkerThreadPool::ParallelForRangeUserData::callback() {
+	singleton->_parallel_for(parallel_for, begin, end);
+}
+
+uint32_t WorkerThreadPool::_get_auto_grain(uint32_t p_elements) const {
+	// Enough chunks for splitting to be able to balance skewed costs, without making them tiny.
+	return MAX(1u, p_elements / (MAX(1u, threads.size()) * 8));
+}
+
+void WorkerThreadPool::_parallel_for(ParallelFor *p_parallel_for, uint32_t p_begin, uint32_t p_end) {
+	int thread_index = get_thread_index();
+	ThreadData *caller_pool_thread = thread_index != -1 ? &threads[thread_index] : nullptr;
+
+	// Lazy binary splitting: the upper half of the remaining range is only handed over as a new task
+	// when the caller's own deque has run dry (meaning the previous half has been stolen), so the amount
+	// of splitting adapts to how many threads are actually idle. Threads outside the pool have no deque,
+	// so they split eagerly just enough times to get every pool thread going.
+	uint32_t max_eager_splits = caller_pool_thread ? 0 : nearest_shift(threads.size()) + 1;
+
+	// Every split halves the range, so there can't be more than 32 of them.
+	TaskID spawned[32];
+	uint32_t spawned_count = 0;
+
+	uint32_t begin = p_begin;
+	uint32_t end = p_end;
+	const uint32_t grain = p_parallel_for->grain;
+
+	while (end - begin > grain) {
+		bool split = false;
+		if (threads.size() > (caller_pool_thread ? 1u : 0u)) { // Otherwise, nobody else could take the work.
+			split = caller_pool_thread ? caller_pool_thread->work_queue.is_empty() : spawned_count < max_eager_splits;
+		}
+
+		if (split) {
+			DEV_ASSERT(spawned_count < 32);
+			uint32_t mid = begin + (end - begin) / 2;
+			ParallelForRangeUserData *ud = memnew(ParallelForRangeUserData);
+			ud->parallel_for = p_parallel_for;
+			ud->begin = mid;
+			ud->end = end;
+			spawned[spawned_count++] = _add_task(Callable(), nullptr, nullptr, ud, true, p_parallel_for->description);
+			end = mid;
+		} else {
+			p_parallel_for->range_func(p_parallel_for->range_func_userdata, begin, begin + grain);
+			begin += grain;
+		}
+	}
+
+	if (begin < end) {
+		p_parallel_for->range_func(p_parallel_for->range_func_userdata, begin, end);
+	}
+
+	// Join newest first; halves nobody stole are still at the bottom of this thread's deque,
+	// so the collaborative wait just runs them here.
+	for (uint32_t i = spawned_count; i > 0; i--) {
+		wait_for_task_completion(spawned[i - 1]);
+	}
+}
+
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
 	MutexLock task_lock(task_mutex);
 	const Group *const *groupp = groups.getptr(p_group);
@@ -716,8 +1021,9 @@ int WorkerThreadPool::get_thread_index() {
 
 WorkerThreadPool::TaskID WorkerThreadPool::get_caller_task_id() {
 	int th_index = get_thread_index();
-	if (th_index != -1 && singleton->threads[th_index].current_task) {
-		return singleton->threads[th_index].current_task->self;
+	Task *current_task = th_index != -1 ? singleton->threads[th_index].current_task.load(std::memory_order_relaxed) : nullptr;
+	if (current_task) {
+		return current_task->self;
 	} else {
 		return INVALID_TASK_ID;
 	}
@@ -766,6 +1072,7 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 
 	for (uint32_t i = 0; i < threads.size(); i++) {
 		threads[i].index = i;
+		threads[i].steal_seed = (i + 1) * 2654435761u; // Must be non-zero.
 		threads[i].thread.start(&WorkerThreadPool::_thread_function, &threads[i]);
 		thread_ids.insert(threads[i].thread.get_id(), i);
 	}
@@ -60,6 +60,63 @@ private:
 		virtual ~BaseTemplateUserdata() {}
 	};
 
+	template <typename C, typename M, typename U>
+	struct TaskUserData : public BaseTemplateUserdata {
+		C *instance;
+		M method;
+		U userdata;
+		virtual void callback() override {
+			(instance->*method)(userdata);
+		}
+	};
+
+public:
+	// A set of tasks with explicit dependencies among them, run as a whole via add_task_graph().
+	// A task is only started once all its predecessors have finished, and the ones without any
+	// are started right away. To keep it acyclic, tasks can only depend on tasks added before them.
+	// The graph must be kept alive until its completion has been awaited.
+	class TaskGraph {
+		friend class WorkerThreadPool;
+
+		struct Node {
+			void (*native_func)(void *) = nullptr;
+			void *native_func_userdata = nullptr;
+			BaseTemplateUserdata *template_userdata = nullptr;
+			uint32_t predecessor_count = 0;
+			LocalVector<uint32_t> successors;
+		};
+
+		LocalVector<Node> nodes;
+		SafeNumeric<uint32_t> *pending_predecessors = nullptr;
+		SafeNumeric<uint32_t> remaining_nodes;
+		Task *completion_task = nullptr;
+		bool high_priority = false;
+		String description;
+
+	public:
+		typedef uint32_t NodeID;
+
+		NodeID add_native_task(void (*p_func)(void *), void *p_userdata);
+		template <typename C, typename M, typename U>
+		NodeID add_template_task(C *p_instance, M p_method, U p_userdata) {
+			typedef TaskUserData<C, M, U> TUD;
+			TUD *ud = memnew(TUD);
+			ud->instance = p_instance;
+			ud->method = p_method;
+			ud->userdata = p_userdata;
+			NodeID id = nodes.size();
+			nodes.push_back(Node());
+			nodes[id].template_userdata = ud;
+			return id;
+		}
+		void add_dependency(NodeID p_predecessor, NodeID p_successor);
+		_FORCE_INLINE_ uint32_t get_task_count() const { return nodes.size(); }
+
+		~TaskGraph();
+	};
+
+private:
+
 	struct Group {
 		GroupID self = -1;
 		SafeNumeric<uint32_t> index;
@@ -72,6 +129,11 @@ private:
 	};
 
 	struct Task {
+		enum {
+			STATE_COMPLETED = 1,
+			STATE_AWAITED = 2, // Someone registered as a waiter, so completing has to notify under the task mutex.
+		};
+
 		TaskID self = -1;
 		Callable callable;
 		void (*native_func)(void *) = nullptr;
@@ -79,27 +141,27 @@ private:
 		void *native_func_userdata = nullptr;
 		String description;
 		Semaphore done_semaphore; // For user threads awaiting.
-		bool completed : 1;
-		bool pending_notify_yield_over : 1;
+		std::atomic<uint32_t> state = { 0 };
+		bool completed = false; // Set under the task mutex once waiters have been notified.
+		std::atomic<bool> pending_notify_yield_over = { false };
 		Group *group = nullptr;
 		SelfList<Task> task_elem;
 		uint32_t waiting_pool = 0;
 		uint32_t waiting_user = 0;
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
-		int pool_thread_index = -1;
+		std::atomic<int> pool_thread_index = { -1 };
 
 		void free_template_userdata();
+		_FORCE_INLINE_ bool is_completed() const { return state.load(std::memory_order_acquire) & STATE_COMPLETED; }
 		Task() :
-				completed(false),
-				pending_notify_yield_over(false),
 				task_elem(this) {}
 	};
 
 	static const uint32_t TASKS_PAGE_SIZE = 1024;
 	static const uint32_t GROUPS_PAGE_SIZE = 256;
 
-	PagedAllocator<Task, false, TASKS_PAGE_SIZE> task_allocator;
+	PagedAllocator<Task, true, TASKS_PAGE_SIZE> task_allocator; // Thread-safe, so tasks that get rid of themselves don't need the task mutex.
 	PagedAllocator<Group, false, GROUPS_PAGE_SIZE> group_allocator;
 
 	SelfList<Task>::List low_priority_task_queue;
@@ -107,6 +169,26 @@ private:
 
 	BinaryMutex task_mutex;
 
+	// Chase-Lev work-stealing deque, one per pool thread.
+	// The owner thread pushes and pops at the bottom (LIFO, keeps nested work hot in cache),
+	// while any other thread can steal from the top (FIFO) without taking the task mutex.
+	// Pushes are only done by the owner while holding the task mutex, so the sleep/wake logic
+	// can check for pending work consistently. Capacity is fixed; on overflow, tasks go to the global queue.
+	struct WorkQueue {
+		static const uint32_t SIZE = 1024;
+		static const uint32_t MASK = SIZE - 1;
+
+		std::atomic<int64_t> top = { 0 };
+		uint8_t padding[64 - sizeof(std::atomic<int64_t>)]; // Keep stealers and owner off the same cache line.
+		std::atomic<int64_t> bottom = { 0 };
+		std::atomic<Task *> buffer[SIZE];
+
+		bool push(Task *p_task);
+		Task *pop();
+		Task *steal();
+		_FORCE_INLINE_ bool is_empty() const { return bottom.load(std::memory_order_acquire) <= top.load(std::memory_order_acquire); }
+	};
+
 	struct ThreadData {
 		static Task *const YIELDING; // Too bad constexpr doesn't work here.
 
@@ -116,9 +198,11 @@ private:
 		bool yield_is_over : 1;
 		bool pre_exited_languages : 1;
 		bool exited_languages : 1;
-		Task *current_task = nullptr;
+		std::atomic<Task *> current_task = { nullptr }; // Only written by the thread itself.
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
+		uint32_t steal_seed = 0;
+		WorkQueue work_queue;
 
 		ThreadData() :
 				signaled(false),
@@ -170,6 +254,9 @@ private:
 
 	void _process_task(Task *task);
 
+	Task *_steal_task(ThreadData *p_thread_data);
+	bool _has_stealable_tasks() const;
+
 	void _post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority, MutexLock<BinaryMutex> &p_lock);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
@@ -189,16 +276,6 @@ private:
 	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
 	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
 
-	template <typename C, typename M, typename U>
-	struct TaskUserData : public BaseTemplateUserdata {
-		C *instance;
-		M method;
-		U userdata;
-		virtual void callback() override {
-			(instance->*method)(userdata);
-		}
-	};
-
 	template <typename C, typename M, typename U>
 	struct GroupUserData : public BaseTemplateUserdata {
 		C *instance;
@@ -209,6 +286,34 @@ private:
 		}
 	};
 
+	struct ParallelFor {
+		void (*range_func)(const void *, uint32_t, uint32_t) = nullptr;
+		const void *range_func_userdata = nullptr;
+		uint32_t grain = 1;
+		String description;
+	};
+
+	struct ParallelForRangeUserData : public BaseTemplateUserdata {
+		ParallelFor *parallel_for = nullptr;
+		uint32_t begin = 0;
+		uint32_t end = 0;
+		virtual void callback() override;
+	};
+
+	void _parallel_for(ParallelFor *p_parallel_for, uint32_t p_begin, uint32_t p_end);
+
+	struct TaskGraphNodeUserData : public BaseTemplateUserdata {
+		TaskGraph *graph = nullptr;
+		uint32_t node = 0;
+		virtual void callback() override;
+	};
+
+	Task *_alloc_task_graph_node_task(TaskGraph *p_graph, uint32_t p_node);
+	void _run_task_graph_node(TaskGraph *p_graph, uint32_t p_node);
+	void _complete_task(Task *p_task);
+	void _notify_task_completed(Task *p_task);
+	uint32_t _get_auto_grain(uint32_t p_elements) const;
+
 	void _wait_collaboratively(ThreadData *p_caller_pool_thread, Task *p_task);
 
 	void _switch_runlevel(Runlevel p_runlevel);
@@ -237,6 +342,10 @@ public:
 	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// Starts the graph and returns a task ID that completes when every task in it has finished,
+	// so it can be awaited or polled like any other task.
+	TaskID add_task_graph(TaskGraph *p_graph, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
 
@@ -258,6 +367,37 @@ public:
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
 
+	// Runs p_func(from, to) over [p_begin, p_end) in chunks of at least p_grain elements (0 picks one automatically),
+	// blocking until all of them are done. The calling thread takes part in the work.
+	// Chunks only run on the calling thread and on pool threads, so per-thread scratch can be indexed by
+	// get_thread_index() + 1, slot 0 being the calling thread when it's outside the pool.
+	// Safe to call from within a pool task, including recursively.
+	template <typename F>
+	void parallel_for_range(uint32_t p_begin, uint32_t p_end, uint32_t p_grain, const F &p_func, const String &p_description = String()) {
+		if (p_begin >= p_end) {
+			return;
+		}
+		ParallelFor pf;
+		pf.range_func = [](const void *p_userdata, uint32_t p_from, uint32_t p_to) {
+			(*(const F *)p_userdata)(p_from, p_to);
+		};
+		pf.range_func_userdata = &p_func;
+		pf.grain = p_grain ? p_grain : _get_auto_grain(p_end - p_begin);
+		pf.description = p_description;
+		_parallel_for(&pf, p_begin, p_end);
+	}
+	// Same as parallel_for_range(), but calls p_func(index) for every element.
+	template <typename F>
+	void parallel_for(uint32_t p_begin, uint32_t p_end, uint32_t p_grain, const F &p_func, const String &p_description = String()) {
+		parallel_for_range(
+				p_begin, p_end, p_grain, [&p_func](uint32_t p_from, uint32_t p_to) {
+					for (uint32_t i = p_from; i < p_to; i++) {
+						p_func(i);
+					}
+				},
+				p_description);
+	}
+
 	_FORCE_INLINE_ int get_thread_count() const { return threads.size(); }
 
 	static WorkerThreadPool *get_singleton() { return singleton; }
@@ -0,0 +1,205 @@
+/**************************************************************************/
+/*  frame_arena.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_arena.h"
+
+SafeNumeric<uint64_t> FrameArena::frame_counter;
+
+struct FrameArenaThreadRef {
+	FrameArena *arena = nullptr;
+
+	~FrameArenaThreadRef() {
+		if (arena) {
+			// Blocks still alive keep the arena around until they are freed.
+			arena->_release();
+		}
+	}
+};
+
+static thread_local FrameArenaThreadRef thread_ref;
+
+FrameArena *FrameArena::get_thread_arena() {
+	if (unlikely(!thread_ref.arena)) {
+		thread_ref.arena = memnew(FrameArena);
+		thread_ref.arena->frame = frame_counter.get();
+	}
+	return thread_ref.arena;
+}
+
+FrameArena::Chunk *FrameArena::_new_chunk(size_t p_min_size) {
+	size_t size = MAX(DEFAULT_CHUNK_SIZE, nearest_power_of_2_templated(p_min_size + CHUNK_HEADER_SIZE));
+	Chunk *chunk = (Chunk *)Memory::alloc_static(size);
+	CRASH_COND_MSG(!chunk, "Out of memory");
+	memnew_placement(chunk, Chunk);
+	chunk->size = size - CHUNK_HEADER_SIZE;
+	return chunk;
+}
+
+void FrameArena::_reset() {
+	frame_peak = MAX(frame_peak, used_in_frame);
+
+	bool fragmented = first && first->next;
+	uint64_t current_frame = frame_counter.get();
+	bool new_frame = frame != current_frame;
+	// Merge everything the arena needed into a single chunk, or give back memory that
+	// wasn't needed during the last frame.
+	bool shrink = new_frame && first && first->size > DEFAULT_CHUNK_SIZE && first->size / 4 > frame_peak;
+
+	if (fragmented || shrink) {
+		while (first) {
+			Chunk *next = first->next;
+			Memory::free_static(first);
+			first = next;
+		}
+		first = _new_chunk(frame_peak);
+	}
+
+	if (new_frame) {
+		frame = current_frame;
+		frame_peak = 0;
+	}
+
+	current = first;
+	if (current) {
+		current->used = 0;
+	}
+	used_in_frame = 0;
+}
+
+void *FrameArena::_alloc(size_t p_bytes) {
+	if (refs.get() == 1 && (used_in_frame > 0 || frame != frame_counter.get())) {
+		// Nothing allocated from this arena is alive, start over.
+		_reset();
+	}
+
+	size_t size = HEADER_SIZE + ((p_bytes + HEADER_SIZE - 1) & ~(HEADER_SIZE - 1));
+
+	if (unlikely(!current)) {
+		first = _new_chunk(size);
+		current = first;
+	} else if (unlikely(current->used + size > current->size)) {
+		// The rest of this chunk is wasted until the next reset.
+		used_in_frame += current->size - current->used;
+		if (current->next && current->next->size >= size) {
+			current = current->next;
+		} else {
+			Chunk *chunk = _new_chunk(size);
+			chunk->next = current->next;
+			current->next = chunk;
+			current = chunk;
+		}
+		current->used = 0;
+	}
+
+	uint8_t *block = current->get_data() + current->used;
+	current->used += size;
+	used_in_frame += size;
+
+	BlockHeader *header = memnew_placement(block, BlockHeader);
+	header->arena = this;
+	header->size = size - HEADER_SIZE;
+	refs.increment();
+
+	return block + HEADER_SIZE;
+}
+
+bool FrameArena::_is_last_block(const BlockHeader *p_header) const {
+	return (const uint8_t *)p_header + HEADER_SIZE + p_header->size == current->get_data() + current->used;
+}
+
+void FrameArena::_release() {
+	if (refs.decrement() == 0) {
+		memdelete(this);
+	}
+}
+
+void *FrameArena::alloc(size_t p_bytes) {
+	return get_thread_arena()->_alloc(p_bytes);
+}
+
+void *FrameArena::realloc(void *p_ptr, size_t p_bytes) {
+	if (!p_ptr) {
+		return alloc(p_bytes);
+	}
+
+	BlockHeader *header = get_header(p_ptr);
+	if (p_bytes <= header->size) {
+		return p_ptr;
+	}
+
+	FrameArena *arena = get_thread_arena();
+	size_t size = (p_bytes + HEADER_SIZE - 1) & ~(HEADER_SIZE - 1);
+
+	if (header->arena == arena && arena->_is_last_block(header) && arena->current->used - header->size + size <= arena->current->size) {
+		// Growing the most recent block, which is what containers being filled do.
+		arena->current->used += size - header->size;
+		arena->used_in_frame += size - header->size;
+		header->size = size;
+		return p_ptr;
+	}
+
+	void *new_ptr = arena->_alloc(p_bytes);
+	memcpy(new_ptr, p_ptr, header->size);
+	free(p_ptr);
+	return new_ptr;
+}
+
+void FrameArena::free(void *p_ptr) {
+	if (!p_ptr) {
+		return;
+	}
+
+	BlockHeader *header = get_header(p_ptr);
+	FrameArena *arena = header->arena;
+
+	if (arena == thread_ref.arena && arena->_is_last_block(header)) {
+		arena->current->used -= HEADER_SIZE + header->size;
+		arena->used_in_frame -= HEADER_SIZE + header->size;
+	}
+
+	arena->_release();
+}
+
+void FrameArena::end_frame() {
+	frame_counter.increment();
+
+	FrameArena *arena = thread_ref.arena;
+	if (arena && arena->refs.get() == 1) {
+		arena->_reset();
+	}
+}
+
+FrameArena::~FrameArena() {
+	while (first) {
+		Chunk *next = first->next;
+		Memory::free_static(first);
+		first = next;
+	}
+}
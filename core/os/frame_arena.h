@@ -0,0 +1,115 @@
+/**************************************************************************/
+/*  frame_arena.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+// Bump allocator for short-lived scratch data, such as the temporary containers
+// used while culling or answering a navigation query.
+//
+// Every thread allocates from its own arena, so allocating is lock-free. Blocks may
+// be freed from any thread. Freeing is cheap and only rewinds the arena when the block
+// is the most recent one; the whole arena is reset as soon as all of its blocks have
+// been freed. At the end of every frame (see `end_frame()`), arenas give back the
+// memory that the peak of the previous frame didn't need.
+//
+// Memory obtained here must not outlive the frame it was allocated in, so don't use
+// it for containers that are kept as members.
+//
+// It has the same interface as `DefaultAllocator`, so it can be passed as the
+// allocator of `LocalVector`.
+class FrameArena {
+	static constexpr size_t HEADER_SIZE = 16;
+	static constexpr size_t CHUNK_HEADER_SIZE = 32;
+	static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+	struct Chunk {
+		Chunk *next = nullptr;
+		size_t size = 0;
+		size_t used = 0;
+		_FORCE_INLINE_ uint8_t *get_data() { return (uint8_t *)this + CHUNK_HEADER_SIZE; }
+	};
+
+	struct BlockHeader {
+		FrameArena *arena = nullptr;
+		size_t size = 0;
+	};
+
+	static_assert(sizeof(Chunk) <= CHUNK_HEADER_SIZE);
+	static_assert(sizeof(BlockHeader) <= HEADER_SIZE);
+
+	Chunk *first = nullptr;
+	Chunk *current = nullptr;
+	// One reference is held by the owner thread, one by every live block.
+	SafeNumeric<uint32_t> refs{ 1 };
+	size_t used_in_frame = 0; // Total bytes used by the chunks before `current`, plus `current->used`.
+	size_t frame_peak = 0;
+	uint64_t frame = 0;
+
+	static SafeNumeric<uint64_t> frame_counter;
+
+	static FrameArena *get_thread_arena();
+	_FORCE_INLINE_ static BlockHeader *get_header(void *p_ptr) { return (BlockHeader *)((uint8_t *)p_ptr - HEADER_SIZE); }
+
+	void *_alloc(size_t p_bytes);
+	bool _is_last_block(const BlockHeader *p_header) const;
+	void _release();
+	void _reset();
+	Chunk *_new_chunk(size_t p_min_size);
+
+public:
+	static void *alloc(size_t p_bytes);
+	static void *realloc(void *p_ptr, size_t p_bytes);
+	static void free(void *p_ptr);
+
+	// Called once per main loop iteration.
+	static void end_frame();
+
+	~FrameArena();
+
+	friend struct FrameArenaThreadRef;
+};
+
+template <typename T>
+class FrameArenaTypedAllocator {
+public:
+	template <typename... Args>
+	_FORCE_INLINE_ T *new_allocation(const Args &&...p_args) { return memnew_allocator(T(p_args...), FrameArena); }
+	_FORCE_INLINE_ void delete_allocation(T *p_allocation) { memdelete_allocator<T, FrameArena>(p_allocation); }
+};
+
+template <typename T, typename U = uint32_t, bool force_trivial = false, bool tight = false>
+using FrameLocalVector = LocalVector<T, U, force_trivial, tight, FrameArena>;
+
+#endif // FRAME_ARENA_H
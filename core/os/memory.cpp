@@ -33,6 +33,10 @@
 #include "core/error/error_macros.h"
 #include "core/templates/safe_refcount.h"
 
+#ifdef MEMORY_POOL_ENABLED
+#include "core/os/spin_lock.h"
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -66,6 +70,269 @@ SafeNumeric<uint64_t> Memory::max_usage;
 
 SafeNumeric<uint64_t> Memory::alloc_count;
 
+#ifdef MEMORY_POOL_ENABLED
+
+// Size-class allocator with per-thread caches (MEMORY_POOL_ENABLED, `memory_pool=yes` SCons option).
+//
+// Small blocks are carved from spans obtained from the system allocator and recycled through a
+// free list per size class and per thread, so most allocations and frees involve no locking at all.
+// Thread caches exchange batches of blocks with a shared free list per size class when they run
+// empty or grow too large. A block freed from another thread than the one that allocated it just
+// goes to the freeing thread's cache, so cross-thread frees need no special path either.
+// Spans are never given back to the system. Blocks above the largest size class go straight to it.
+//
+// Every block is prefixed by a header holding its size class (and size for large blocks).
+//
+//	┌─────────────────┬──────────┬──────────────...
+//	│ uint32_t        │ uint64_t │ data
+//	│ size class      │ size     │
+//	└─────────────────┴──────────┴──────────────...
+//	↑ block start                ↑ POOL_HEADER_SIZE (keeps max_align_t alignment)
+
+namespace {
+
+SafeNumeric<uint64_t> pool_reserved;
+SafeNumeric<uint64_t> pool_refill_count;
+
+constexpr size_t POOL_HEADER_SIZE = 16;
+static_assert(alignof(max_align_t) <= POOL_HEADER_SIZE);
+
+// Block sizes, header included.
+constexpr uint32_t POOL_SIZE_CLASSES[] = {
+	32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512,
+	640, 768, 896, 1024, 1280, 1536, 1792, 2048
+};
+constexpr uint32_t POOL_SIZE_CLASS_COUNT = sizeof(POOL_SIZE_CLASSES) / sizeof(POOL_SIZE_CLASSES[0]);
+constexpr uint32_t POOL_MAX_SMALL_SIZE = POOL_SIZE_CLASSES[POOL_SIZE_CLASS_COUNT - 1];
+constexpr uint32_t POOL_LARGE_CLASS = UINT32_MAX;
+constexpr size_t POOL_SPAN_SIZE = 64 * 1024;
+constexpr uint32_t POOL_BATCH_BYTES = 8 * 1024;
+
+struct PoolSizeClassTable {
+	uint8_t size_class[POOL_MAX_SMALL_SIZE / 16 + 1] = {};
+	uint32_t batch[POOL_SIZE_CLASS_COUNT] = {};
+
+	constexpr PoolSizeClassTable() {
+		uint32_t c = 0;
+		for (uint32_t i = 0; i <= POOL_MAX_SMALL_SIZE / 16; i++) {
+			while (POOL_SIZE_CLASSES[c] < i * 16) {
+				c++;
+			}
+			size_class[i] = c;
+		}
+		for (uint32_t i = 0; i < POOL_SIZE_CLASS_COUNT; i++) {
+			uint32_t b = POOL_BATCH_BYTES / POOL_SIZE_CLASSES[i];
+			batch[i] = b < 4 ? 4 : (b > 64 ? 64 : b);
+		}
+	}
+};
+
+constexpr PoolSizeClassTable pool_table;
+
+struct PoolBlock {
+	PoolBlock *next;
+};
+
+struct PoolCentralList {
+	SpinLock lock;
+	PoolBlock *head = nullptr;
+};
+
+PoolCentralList pool_central[POOL_SIZE_CLASS_COUNT];
+
+// Takes up to p_count blocks of the class as a list starting at r_first, carving a new span if needed.
+// Returns how many were taken.
+uint32_t pool_central_take(uint32_t p_class, uint32_t p_count, PoolBlock *&r_first) {
+	PoolCentralList &central = pool_central[p_class];
+	central.lock.lock();
+
+	if (!central.head) {
+		// Carve a new span.
+		const uint32_t block_size = POOL_SIZE_CLASSES[p_class];
+		const uint32_t block_count = POOL_SPAN_SIZE / block_size;
+		uint8_t *span = (uint8_t *)malloc(POOL_SPAN_SIZE);
+		if (!span) {
+			central.lock.unlock();
+			r_first = nullptr;
+			return 0;
+		}
+		for (uint32_t i = 0; i < block_count; i++) {
+			PoolBlock *block = (PoolBlock *)(span + i * block_size);
+			block->next = i + 1 < block_count ? (PoolBlock *)(span + (i + 1) * block_size) : central.head;
+		}
+		central.head = (PoolBlock *)span;
+		pool_reserved.add(POOL_SPAN_SIZE);
+	}
+
+	r_first = central.head;
+	PoolBlock *last = central.head;
+	uint32_t taken = 1;
+	while (taken < p_count && last->next) {
+		last = last->next;
+		taken++;
+	}
+	central.head = last->next;
+	last->next = nullptr;
+
+	central.lock.unlock();
+	pool_refill_count.increment();
+	return taken;
+}
+
+void pool_central_give(uint32_t p_class, PoolBlock *p_first, PoolBlock *p_last) {
+	PoolCentralList &central = pool_central[p_class];
+	central.lock.lock();
+	p_last->next = central.head;
+	central.head = p_first;
+	central.lock.unlock();
+}
+
+struct PoolThreadCache {
+	PoolBlock *head[POOL_SIZE_CLASS_COUNT] = {};
+	uint32_t count[POOL_SIZE_CLASS_COUNT] = {};
+
+	~PoolThreadCache();
+};
+
+thread_local PoolThreadCache pool_thread_cache;
+// Stays valid after the cache is destroyed, so late frees at thread exit bypass it.
+thread_local bool pool_thread_cache_gone = false;
+
+PoolThreadCache::~PoolThreadCache() {
+	for (uint32_t i = 0; i < POOL_SIZE_CLASS_COUNT; i++) {
+		if (head[i]) {
+			PoolBlock *last = head[i];
+			while (last->next) {
+				last = last->next;
+			}
+			pool_central_give(i, head[i], last);
+			head[i] = nullptr;
+			count[i] = 0;
+		}
+	}
+	pool_thread_cache_gone = true;
+}
+
+void *pool_alloc(size_t p_bytes) {
+	size_t total = p_bytes + POOL_HEADER_SIZE;
+	if (total > POOL_MAX_SMALL_SIZE) {
+		uint8_t *mem = (uint8_t *)malloc(total);
+		if (!mem) {
+			return nullptr;
+		}
+		*(uint32_t *)mem = POOL_LARGE_CLASS;
+		*(uint64_t *)(mem + sizeof(uint64_t)) = p_bytes;
+		return mem + POOL_HEADER_SIZE;
+	}
+
+	uint32_t size_class = pool_table.size_class[(total + 15) >> 4];
+	PoolBlock *block = nullptr;
+
+	if (likely(!pool_thread_cache_gone)) {
+		PoolThreadCache &cache = pool_thread_cache;
+		if (unlikely(!cache.head[size_class])) {
+			cache.count[size_class] = pool_central_take(size_class, pool_table.batch[size_class], cache.head[size_class]);
+		}
+		block = cache.head[size_class];
+		if (block) {
+			cache.head[size_class] = block->next;
+			cache.count[size_class]--;
+		}
+	} else {
+		pool_central_take(size_class, 1, block);
+	}
+
+	if (!block) {
+		return nullptr;
+	}
+	*(uint32_t *)block = size_class;
+	return (uint8_t *)block + POOL_HEADER_SIZE;
+}
+
+void pool_free(void *p_memory) {
+	uint8_t *mem = (uint8_t *)p_memory - POOL_HEADER_SIZE;
+	uint32_t size_class = *(uint32_t *)mem;
+	if (size_class == POOL_LARGE_CLASS) {
+		free(mem);
+		return;
+	}
+
+	PoolBlock *block = (PoolBlock *)mem;
+	if (unlikely(pool_thread_cache_gone)) {
+		block->next = nullptr;
+		pool_central_give(size_class, block, block);
+		return;
+	}
+
+	PoolThreadCache &cache = pool_thread_cache;
+	block->next = cache.head[size_class];
+	cache.head[size_class] = block;
+	cache.count[size_class]++;
+
+	const uint32_t batch = pool_table.batch[size_class];
+	if (unlikely(cache.count[size_class] > batch * 2)) {
+		// Give a batch back, so blocks freed by a thread which doesn't allocate them don't pile up here.
+		PoolBlock *first = cache.head[size_class];
+		PoolBlock *last = first;
+		for (uint32_t i = 1; i < batch; i++) {
+			last = last->next;
+		}
+		cache.head[size_class] = last->next;
+		cache.count[size_class] -= batch;
+		pool_central_give(size_class, first, last);
+	}
+}
+
+void *pool_realloc(void *p_memory, size_t p_bytes) {
+	if (p_bytes == 0) {
+		pool_free(p_memory);
+		return nullptr;
+	}
+
+	uint8_t *mem = (uint8_t *)p_memory - POOL_HEADER_SIZE;
+	uint32_t size_class = *(uint32_t *)mem;
+	size_t old_capacity;
+	if (size_class == POOL_LARGE_CLASS) {
+		if (p_bytes + POOL_HEADER_SIZE > POOL_MAX_SMALL_SIZE) {
+			mem = (uint8_t *)realloc(mem, p_bytes + POOL_HEADER_SIZE);
+			if (!mem) {
+				return nullptr;
+			}
+			*(uint64_t *)(mem + sizeof(uint64_t)) = p_bytes;
+			return mem + POOL_HEADER_SIZE;
+		}
+		old_capacity = *(uint64_t *)(mem + sizeof(uint64_t));
+	} else {
+		old_capacity = POOL_SIZE_CLASSES[size_class] - POOL_HEADER_SIZE;
+		size_t lower_capacity = size_class > 0 ? POOL_SIZE_CLASSES[size_class - 1] - POOL_HEADER_SIZE : 0;
+		if (p_bytes <= old_capacity && p_bytes > lower_capacity) {
+			return p_memory; // Still the best fitting class.
+		}
+	}
+
+	void *new_memory = pool_alloc(p_bytes);
+	if (!new_memory) {
+		return nullptr;
+	}
+	memcpy(new_memory, p_memory, MIN(old_capacity, p_bytes));
+	pool_free(p_memory);
+	return new_memory;
+}
+
+} // namespace
+
+#define MEMORY_BACKEND_ALLOC(m_bytes) pool_alloc(m_bytes)
+#define MEMORY_BACKEND_REALLOC(m_mem, m_bytes) pool_realloc(m_mem, m_bytes)
+#define MEMORY_BACKEND_FREE(m_mem) pool_free(m_mem)
+
+#else
+
+#define MEMORY_BACKEND_ALLOC(m_bytes) malloc(m_bytes)
+#define MEMORY_BACKEND_REALLOC(m_mem, m_bytes) realloc(m_mem, m_bytes)
+#define MEMORY_BACKEND_FREE(m_mem) free(m_mem)
+
+#endif // MEMORY_POOL_ENABLED
+
 inline bool is_power_of_2(size_t x) { return x && ((x & (x - 1U)) == 0U); }
 
 void *Memory::alloc_aligned_static(size_t p_bytes, size_t p_alignment) {
@@ -105,7 +372,7 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
-	void *mem = malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+	void *mem = MEMORY_BACKEND_ALLOC(p_bytes + (prepad ? DATA_OFFSET : 0));
 
 	ERR_FAIL_NULL_V(mem, nullptr);
 
@@ -154,12 +421,12 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 #endif
 
 		if (p_bytes == 0) {
-			free(mem);
+			MEMORY_BACKEND_FREE(mem);
 			return nullptr;
 		} else {
 			*s = p_bytes;
 
-			mem = (uint8_t *)realloc(mem, p_bytes + DATA_OFFSET);
+			mem = (uint8_t *)MEMORY_BACKEND_REALLOC(mem, p_bytes + DATA_OFFSET);
 			ERR_FAIL_NULL_V(mem, nullptr);
 
 			s = (uint64_t *)(mem + SIZE_OFFSET);
@@ -169,7 +436,7 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 			return mem + DATA_OFFSET;
 		}
 	} else {
-		mem = (uint8_t *)realloc(mem, p_bytes);
+		mem = (uint8_t *)MEMORY_BACKEND_REALLOC(mem, p_bytes);
 
 		ERR_FAIL_COND_V(mem == nullptr && p_bytes > 0, nullptr);
 
@@ -198,9 +465,9 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 		mem_usage.sub(*s);
 #endif
 
-		free(mem);
+		MEMORY_BACKEND_FREE(mem);
 	} else {
-		free(mem);
+		MEMORY_BACKEND_FREE(mem);
 	}
 }
 
@@ -224,6 +491,22 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+uint64_t Memory::get_pool_reserved() {
+#ifdef MEMORY_POOL_ENABLED
+	return pool_reserved.get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_pool_refill_count() {
+#ifdef MEMORY_POOL_ENABLED
+	return pool_refill_count.get();
+#else
+	return 0;
+#endif
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
@@ -89,11 +89,17 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	// Bytes reserved from the system for small blocks, and number of batches of them handed
+	// to thread caches, when built with the pooled allocator. Zero otherwise.
+	static uint64_t get_pool_reserved();
+	static uint64_t get_pool_refill_count();
 };
 
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_memory) { return Memory::realloc_static(p_ptr, p_memory, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
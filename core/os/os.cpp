@@ -223,6 +223,13 @@ uint64_t OS::get_embedded_pck_offset() const {
 	return 0;
 }
 
+const uint8_t *OS::map_file(const String &p_path, uint64_t &r_length) const {
+	return nullptr;
+}
+
+void OS::unmap_file(const uint8_t *p_data, uint64_t p_length) const {
+}
+
 // Helper function to ensure that a dir name/path will be valid on the OS
 String OS::get_safe_dir_name(const String &p_dir_name, bool p_allow_paths) const {
 	String safe_dir_name = p_dir_name;
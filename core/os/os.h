@@ -281,6 +281,17 @@ public:
 
 	virtual uint64_t get_embedded_pck_offset() const;
 
+	// Read-only mapping of a whole file in memory, returns null if unsupported or on failure.
+	// `p_path` is an absolute path in the host file system.
+	// The mapping doesn't protect against the file changing underneath it. On Unix, reading pages
+	// past the end of a file that was truncated since raises SIGBUS and kills the process, and a
+	// file rewritten in place changes what the mapping reads. On Windows, the file can't be deleted,
+	// replaced or truncated while it's mapped. Only map files that aren't modified while running.
+	virtual const uint8_t *map_file(const String &p_path, uint64_t &r_length) const;
+	virtual void unmap_file(const uint8_t *p_data, uint64_t p_length) const;
+	// Hints that a range of a mapping will be read soon, so its pages can be loaded in the background.
+	virtual void prefetch_mapped(const uint8_t *p_data, uint64_t p_length) const {}
+
 	String get_safe_dir_name(const String &p_dir_name, bool p_allow_paths = false) const;
 	virtual String get_godot_dir_name() const;
 
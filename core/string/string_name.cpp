@@ -67,11 +67,209 @@ StringName _scs_create(const char *p_chr, bool p_static) {
 	return (p_chr[0] ? StringName(StaticCString::create(p_chr), p_static) : StringName());
 }
 
+std::atomic<std::atomic<StringName::_Link *> *> StringName::_bucket_segments[BUCKET_SEGMENT_COUNT];
+std::atomic<uint32_t> StringName::_bucket_count{ 0 };
+uint32_t StringName::_name_count = 0;
+StringName::_Link StringName::_list_head;
+StringName::_ReaderCount StringName::_readers[READER_SLOTS];
+StringName::_Data *StringName::_retired = nullptr;
+
+static _FORCE_INLINE_ uint32_t _reverse_bits(uint32_t p_value) {
+	p_value = ((p_value >> 1) & 0x55555555) | ((p_value & 0x55555555) << 1);
+	p_value = ((p_value >> 2) & 0x33333333) | ((p_value & 0x33333333) << 2);
+	p_value = ((p_value >> 4) & 0x0F0F0F0F) | ((p_value & 0x0F0F0F0F) << 4);
+	p_value = ((p_value >> 8) & 0x00FF00FF) | ((p_value & 0x00FF00FF) << 8);
+	return (p_value >> 16) | (p_value << 16);
+}
+
+static thread_local uint32_t reader_slot = UINT32_MAX;
+static std::atomic<uint32_t> reader_slot_counter{ 0 };
+
+std::atomic<uint32_t> &StringName::_get_reader_count() {
+	if (unlikely(reader_slot == UINT32_MAX)) {
+		reader_slot = reader_slot_counter.fetch_add(1, std::memory_order_relaxed) % READER_SLOTS;
+	}
+	return _readers[reader_slot].count;
+}
+
+StringName::_Link *StringName::_get_bucket(uint32_t p_hash) {
+	// Buckets are initialized before the count that includes them is published.
+	uint32_t bucket = p_hash & (_bucket_count.load(std::memory_order_acquire) - 1);
+	std::atomic<_Link *> *segment = _bucket_segments[bucket >> BUCKET_SEGMENT_BITS].load(std::memory_order_acquire);
+	return segment[bucket & BUCKET_SEGMENT_MASK].load(std::memory_order_acquire);
+}
+
+void StringName::_init_bucket(uint32_t p_bucket) {
+	std::atomic<_Link *> *segment = _bucket_segments[p_bucket >> BUCKET_SEGMENT_BITS].load(std::memory_order_relaxed);
+	if (!segment) {
+		segment = (std::atomic<_Link *> *)Memory::alloc_static(sizeof(std::atomic<_Link *>) * BUCKET_SEGMENT_SIZE);
+		for (uint32_t i = 0; i < BUCKET_SEGMENT_SIZE; i++) {
+			memnew_placement(&segment[i], std::atomic<_Link *>(nullptr));
+		}
+		_bucket_segments[p_bucket >> BUCKET_SEGMENT_BITS].store(segment, std::memory_order_release);
+	}
+
+	if (p_bucket == 0) {
+		segment[0].store(&_list_head, std::memory_order_release);
+		return;
+	}
+
+	// The parent bucket (this one without its highest bit) covers the same part of the list.
+	uint32_t parent = p_bucket & ~(1u << (nearest_shift(p_bucket) - 1));
+	_Link *pred = _bucket_segments[parent >> BUCKET_SEGMENT_BITS].load(std::memory_order_relaxed)[parent & BUCKET_SEGMENT_MASK].load(std::memory_order_relaxed);
+
+	_Link *sentinel = memnew(_Link);
+	sentinel->order = _reverse_bits(p_bucket);
+
+	_Link *next = pred->next.load(std::memory_order_relaxed);
+	while (next && next->order < sentinel->order) {
+		pred = next;
+		next = next->next.load(std::memory_order_relaxed);
+	}
+	sentinel->next.store(next, std::memory_order_relaxed);
+	pred->next.store(sentinel, std::memory_order_release);
+
+	segment[p_bucket & BUCKET_SEGMENT_MASK].store(sentinel, std::memory_order_release);
+}
+
+void StringName::_insert(_Data *p_data) {
+	// Called with the mutex locked.
+	_Link *pred = _get_bucket(p_data->hash);
+	_Link *next = pred->next.load(std::memory_order_relaxed);
+	while (next && next->order <= p_data->order) {
+		pred = next;
+		next = next->next.load(std::memory_order_relaxed);
+	}
+	p_data->next.store(next, std::memory_order_relaxed);
+	pred->next.store(p_data, std::memory_order_release);
+
+	_name_count++;
+	uint32_t bucket_count = _bucket_count.load(std::memory_order_relaxed);
+	if (_name_count > bucket_count * 2 && bucket_count < MAX_BUCKET_COUNT) {
+		for (uint32_t i = bucket_count; i < bucket_count * 2; i++) {
+			_init_bucket(i);
+		}
+		_bucket_count.store(bucket_count * 2, std::memory_order_release);
+	}
+}
+
+void StringName::_remove(_Data *p_data) {
+	// Called with the mutex locked.
+	_Link *pred = _get_bucket(p_data->hash);
+	_Link *next = pred->next.load(std::memory_order_relaxed);
+	while (next != p_data) {
+		ERR_FAIL_NULL_MSG(next, "BUG: StringName not found in table.");
+		pred = next;
+		next = next->next.load(std::memory_order_relaxed);
+	}
+
+	// Lookups walking past this entry keep following its link until it's reclaimed.
+	pred->next.store(p_data->next.load(std::memory_order_relaxed), std::memory_order_seq_cst);
+	_name_count--;
+
+	p_data->next_retired = _retired;
+	_retired = p_data;
+	_reclaim();
+}
+
+void StringName::_reclaim() {
+	// Called with the mutex locked. Lookups that start after an entry was unlinked can't
+	// reach it, so it can be freed once every lookup in flight at that point has ended.
+	if (!_retired) {
+		return;
+	}
+	for (uint32_t i = 0; i < READER_SLOTS; i++) {
+		if (_readers[i].count.load(std::memory_order_seq_cst) != 0) {
+			return;
+		}
+	}
+	while (_retired) {
+		_Data *d = _retired;
+		_retired = d->next_retired;
+		memdelete(d);
+	}
+}
+
+template <typename T>
+StringName::_Data *StringName::_find(uint32_t p_hash, const T &p_name) {
+	std::atomic<uint32_t> &readers = _get_reader_count();
+	readers.fetch_add(1, std::memory_order_seq_cst);
+
+	_Data *found = nullptr;
+	uint32_t order = _reverse_bits(p_hash) | 1;
+	for (_Link *link = _get_bucket(p_hash)->next.load(std::memory_order_acquire); link && link->order <= order; link = link->next.load(std::memory_order_acquire)) {
+		if (link->order != order) {
+			continue; // Bucket sentinel.
+		}
+		_Data *d = static_cast<_Data *>(link);
+		// compare hash first
+		// An entry that is being removed fails to ref, a new one may follow it.
+		if (d->hash == p_hash && d->operator==(p_name) && d->try_ref()) {
+			found = d;
+			break;
+		}
+	}
+
+	readers.fetch_sub(1, std::memory_order_release);
+	return found;
+}
+
+template <typename T>
+StringName::_Data *StringName::_intern(uint32_t p_hash, const T &p_name, const char *p_cname, bool p_static) {
+	_Data *d = _find(p_hash, p_name);
+
+	if (!d) {
+		MutexLock lock(mutex);
+
+		// Another thread may have added it in the meantime.
+		d = _find(p_hash, p_name);
+		if (!d) {
+			d = memnew(_Data);
+			if (p_cname) {
+				d->cname = p_cname;
+			} else {
+				d->name = p_name;
+			}
+			d->refcount.init();
+			d->static_count.set(p_static ? 1 : 0);
+			if (p_static) {
+				d->immortal.set();
+			}
+			d->hash = p_hash;
+			d->order = _reverse_bits(p_hash) | 1;
+#ifdef DEBUG_ENABLED
+			if (unlikely(debug_stringname)) {
+				// Keep in memory, force static.
+				d->refcount.ref();
+				d->static_count.increment();
+				d->immortal.set();
+			}
+#endif
+			_insert(d);
+			return d;
+		}
+	}
+
+	// exists
+	if (p_static) {
+		d->static_count.increment();
+		d->immortal.set();
+	}
+#ifdef DEBUG_ENABLED
+	if (unlikely(debug_stringname)) {
+		d->debug_references++;
+	}
+#endif
+	return d;
+}
+
 void StringName::setup() {
 	ERR_FAIL_COND(configured);
-	for (int i = 0; i < STRING_TABLE_LEN; i++) {
-		_table[i] = nullptr;
+	_list_head.next.store(nullptr);
+	for (uint32_t i = 0; i < MIN_BUCKET_COUNT; i++) {
+		_init_bucket(i);
 	}
+	_bucket_count.store(MIN_BUCKET_COUNT);
 	configured = true;
 }
 
@@ -81,11 +279,9 @@ void StringName::cleanup() {
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		Vector<_Data *> data;
-		for (int i = 0; i < STRING_TABLE_LEN; i++) {
-			_Data *d = _table[i];
-			while (d) {
-				data.push_back(d);
-				d = d->next;
+		for (_Link *link = _list_head.next.load(); link; link = link->next.load()) {
+			if (link->order & 1) {
+				data.push_back(static_cast<_Data *>(link));
 			}
 		}
 
@@ -108,10 +304,13 @@ void StringName::cleanup() {
 	}
 #endif
 	int lost_strings = 0;
-	for (int i = 0; i < STRING_TABLE_LEN; i++) {
-		while (_table[i]) {
-			_Data *d = _table[i];
-			if (d->static_count.get() != d->refcount.get()) {
+	_Link *link = _list_head.next.load();
+	while (link) {
+		_Link *next = link->next.load();
+		if (link->order & 1) {
+			_Data *d = static_cast<_Data *>(link);
+			// Static names don't track their references.
+			if (!d->immortal.is_set() && d->refcount.get() != 0) {
 				lost_strings++;
 
 				if (OS::get_singleton()->is_stdout_verbose()) {
@@ -120,11 +319,30 @@ void StringName::cleanup() {
 					print_line(vformat("Orphan StringName: %s (static: %d, total: %d)", dname, d->static_count.get(), d->refcount.get()));
 				}
 			}
-
-			_table[i] = _table[i]->next;
 			memdelete(d);
+		} else {
+			memdelete(link);
 		}
+		link = next;
+	}
+	_list_head.next.store(nullptr);
+
+	while (_retired) {
+		_Data *d = _retired;
+		_retired = d->next_retired;
+		memdelete(d);
 	}
+
+	for (uint32_t i = 0; i < BUCKET_SEGMENT_COUNT; i++) {
+		std::atomic<_Link *> *segment = _bucket_segments[i].load();
+		if (segment) {
+			Memory::free_static(segment);
+			_bucket_segments[i].store(nullptr);
+		}
+	}
+	_bucket_count.store(0);
+	_name_count = 0;
+
 	if (lost_strings) {
 		print_verbose(vformat("StringName: %d unclaimed string names at exit.", lost_strings));
 	}
@@ -134,7 +352,7 @@ void StringName::cleanup() {
 void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
-	if (_data && _data->refcount.unref()) {
+	if (_data && !_data->immortal.is_set() && _data->refcount.unref()) {
 		MutexLock lock(mutex);
 
 		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
@@ -144,19 +362,7 @@ void StringName::unref() {
 				ERR_PRINT("BUG: Unreferenced static string to 0: " + String(_data->name));
 			}
 		}
-		if (_data->prev) {
-			_data->prev->next = _data->next;
-		} else {
-			if (_table[_data->idx] != _data) {
-				ERR_PRINT("BUG!");
-			}
-			_table[_data->idx] = _data->next;
-		}
-
-		if (_data->next) {
-			_data->next->prev = _data->prev;
-		}
-		memdelete(_data);
+		_remove(_data);
 	}
 
 	_data = nullptr;
@@ -242,7 +448,7 @@ StringName &StringName::operator=(const StringName &p_name) {
 
 	unref();
 
-	if (p_name._data && p_name._data->refcount.ref()) {
+	if (p_name._data && p_name._data->try_ref()) {
 		_data = p_name._data;
 	}
 
@@ -254,7 +460,7 @@ StringName::StringName(const StringName &p_name) {
 
 	ERR_FAIL_COND(!configured);
 
-	if (p_name._data && p_name._data->refcount.ref()) {
+	if (p_name._data && p_name._data->try_ref()) {
 		_data = p_name._data;
 	}
 }
@@ -275,56 +481,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
-	uint32_t hash = String::hash(p_name);
-
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->operator==(p_name)) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return;
-	}
-
-	_data = memnew(_Data);
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->idx = idx;
-	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
-
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_data = _intern(String::hash(p_name), p_name, nullptr, p_static);
 }
 
 StringName::StringName(const StaticCString &p_static_string, bool p_static) {
@@ -334,55 +491,7 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
-	uint32_t hash = String::hash(p_static_string.ptr);
-
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->operator==(p_static_string.ptr)) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return;
-	}
-
-	_data = memnew(_Data);
-
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->idx = idx;
-	_data->cname = p_static_string.ptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_data = _intern(String::hash(p_static_string.ptr), p_static_string.ptr, p_static_string.ptr, p_static);
 }
 
 StringName::StringName(const String &p_name, bool p_static) {
@@ -394,54 +503,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
-	uint32_t hash = p_name.hash();
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_data = _table[idx];
-
-	while (_data) {
-		if (_data->hash == hash && _data->operator==(p_name)) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return;
-	}
-
-	_data = memnew(_Data);
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->idx = idx;
-	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_data = _intern(p_name.hash(), p_name, nullptr, p_static);
 }
 
 StringName StringName::search(const char *p_name) {
@@ -452,22 +514,9 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
-	uint32_t hash = String::hash(p_name);
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->operator==(p_name)) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_Data *_data = _find(String::hash(p_name), p_name);
 
-	if (_data && _data->refcount.ref()) {
+	if (_data) {
 #ifdef DEBUG_ENABLED
 		if (unlikely(debug_stringname)) {
 			_data->debug_references++;
@@ -488,23 +537,9 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
-	uint32_t hash = String::hash(p_name);
-
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->operator==(p_name)) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_Data *_data = _find(String::hash(p_name), String(p_name));
 
-	if (_data && _data->refcount.ref()) {
+	if (_data) {
 		return StringName(_data);
 	}
 
@@ -514,23 +549,9 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name.is_empty(), StringName());
 
-	MutexLock lock(mutex);
-
-	uint32_t hash = p_name.hash();
+	_Data *_data = _find(p_name.hash(), p_name);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->operator==(p_name)) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
+	if (_data) {
 #ifdef DEBUG_ENABLED
 		if (unlikely(debug_stringname)) {
 			_data->debug_references++;
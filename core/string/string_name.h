@@ -46,14 +46,29 @@ struct StaticCString {
 
 class StringName {
 	enum {
-		STRING_TABLE_BITS = 16,
-		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		BUCKET_SEGMENT_BITS = 12,
+		BUCKET_SEGMENT_SIZE = 1 << BUCKET_SEGMENT_BITS,
+		BUCKET_SEGMENT_MASK = BUCKET_SEGMENT_SIZE - 1,
+		BUCKET_SEGMENT_COUNT = 1 << 12,
+		MIN_BUCKET_COUNT = BUCKET_SEGMENT_SIZE,
+		MAX_BUCKET_COUNT = BUCKET_SEGMENT_SIZE * BUCKET_SEGMENT_COUNT,
+		READER_SLOTS = 16,
 	};
 
-	struct _Data {
+	// All names are kept in a single linked list sorted by their bit-reversed hash, and
+	// every bucket points to a sentinel link inside that list (a split-ordered list).
+	// Growing the table only inserts sentinels, so lookups can walk the list without
+	// locking while other threads add or remove names.
+	struct _Link {
+		std::atomic<_Link *> next = nullptr;
+		uint32_t order = 0; // Bit-reversed hash, odd for names and even for bucket sentinels.
+	};
+
+	struct _Data : public _Link {
 		SafeRefCount refcount;
 		SafeNumeric<uint32_t> static_count;
+		// Static names are never freed while the table is configured, so they aren't refcounted.
+		SafeFlag immortal;
 		const char *cname = nullptr;
 		String name;
 #ifdef DEBUG_ENABLED
@@ -65,17 +80,39 @@ class StringName {
 		bool operator==(const char *p_name) const;
 		bool operator!=(const char *p_name) const;
 
-		int idx = 0;
+		_FORCE_INLINE_ bool try_ref() { return immortal.is_set() || refcount.ref(); }
+
 		uint32_t hash = 0;
-		_Data *prev = nullptr;
-		_Data *next = nullptr;
+		_Data *next_retired = nullptr;
 		_Data() {}
 	};
 
-	static inline _Data *_table[STRING_TABLE_LEN];
+	// Number of lookups in flight, spread over a few cache lines. Removed names are only
+	// freed once all of them have been seen at zero.
+	struct alignas(64) _ReaderCount {
+		std::atomic<uint32_t> count{ 0 };
+	};
+
+	static std::atomic<std::atomic<_Link *> *> _bucket_segments[BUCKET_SEGMENT_COUNT];
+	static std::atomic<uint32_t> _bucket_count;
+	static uint32_t _name_count;
+	static _Link _list_head;
+	static _ReaderCount _readers[READER_SLOTS];
+	static _Data *_retired;
 
 	_Data *_data = nullptr;
 
+	static std::atomic<uint32_t> &_get_reader_count();
+	static _Link *_get_bucket(uint32_t p_hash);
+	static void _init_bucket(uint32_t p_bucket);
+	static void _insert(_Data *p_data);
+	static void _remove(_Data *p_data);
+	static void _reclaim();
+	template <typename T>
+	static _Data *_find(uint32_t p_hash, const T &p_name);
+	template <typename T>
+	static _Data *_intern(uint32_t p_hash, const T &p_name, const char *p_cname, bool p_static);
+
 	void unref();
 	friend void register_core_types();
 	friend void unregister_core_types();
@@ -39,6 +39,7 @@
 #include "core/string/string_name.h"
 #include "core/string/translation_server.h"
 #include "core/string/ucaps.h"
+#include "core/templates/small_vector.h"
 #include "core/variant/variant.h"
 #include "core/version_generated.gen.h"
 
@@ -4119,7 +4120,7 @@ static String _replace_common(const String &p_this, const String &p_key, const S
 	int search_from = 0;
 	int result = 0;
 
-	LocalVector<int> found;
+	SmallVector<int, 32> found;
 
 	while ((result = (p_case_insensitive ? p_this.findn(p_key, search_from) : p_this.find(p_key, search_from))) >= 0) {
 		found.push_back(result);
@@ -4175,7 +4176,7 @@ static String _replace_common(const String &p_this, char const *p_key, char cons
 	int search_from = 0;
 	int result = 0;
 
-	LocalVector<int> found;
+	SmallVector<int, 32> found;
 
 	while ((result = (p_case_insensitive ? p_this.findn(p_key, search_from) : p_this.find(p_key, search_from))) >= 0) {
 		found.push_back(result);
@@ -33,9 +33,155 @@
 #include "core/config/project_settings.h"
 #include "core/os/os.h"
 
+BinaryMutex CommandQueueMT::queues_mutex;
+LocalVector<CommandQueueMT *> CommandQueueMT::queues;
+std::atomic<uint64_t> CommandQueueMT::total_stall_usec = 0;
+
+CommandQueueMT::Block *CommandQueueMT::_alloc_block() {
+	// Called with the mutex locked.
+	Block *block = free_blocks;
+	if (block) {
+		free_blocks = block->next.load(std::memory_order_relaxed);
+	} else {
+		block = (Block *)memalloc(sizeof(Block));
+		memset(block->data, 0, BLOCK_SIZE);
+	}
+	block->next.store(nullptr, std::memory_order_relaxed);
+	block->index.store(block_count++, std::memory_order_relaxed);
+	// Producers may still hold this block from its previous use, from now on their claims are valid.
+	block->reserved.store(0, std::memory_order_release);
+	return block;
+}
+
+void CommandQueueMT::_add_block(Block *p_full_block, uint64_t p_block_index) {
+	MutexLock lock(mutex);
+	if (tail.load(std::memory_order_relaxed) != p_full_block) {
+		return; // Another producer got here first.
+	}
+	if (p_full_block->index.load(std::memory_order_relaxed) != p_block_index || p_full_block->reserved.load(std::memory_order_relaxed) < BLOCK_SIZE) {
+		// The block filled up in a previous use and was recycled as the tail since, it has room again.
+		return;
+	}
+
+	Block *block = _alloc_block();
+	tail.store(block, std::memory_order_release);
+	p_full_block->next.store(block, std::memory_order_release);
+}
+
+void CommandQueueMT::_flush() {
+	if (unlikely(flush_thread.load(std::memory_order_relaxed) == Thread::get_caller_id())) {
+		// Re-entrant call.
+		return;
+	}
+
+	MutexLock flush_lock(flush_mutex);
+	flush_thread.store(Thread::get_caller_id(), std::memory_order_relaxed);
+
+	// Anything pushed from now on must notify the pump again.
+	pump_notified.exchange(false, std::memory_order_acq_rel);
+
+	while (true) {
+		uint32_t reserved = head->reserved.load(std::memory_order_acquire);
+		if (read_offset < reserved && read_offset < BLOCK_SIZE) {
+			std::atomic<uint32_t> *header = _get_header(head, read_offset);
+			uint32_t size = header->load(std::memory_order_acquire);
+			for (uint32_t spins = 0; unlikely(size == 0); spins++) {
+				// Claimed but not published yet, the producer is still writing it.
+				if (spins > 64) {
+					OS::get_singleton()->delay_usec(1);
+				}
+				size = header->load(std::memory_order_acquire);
+			}
+
+			if (size != END_OF_BLOCK) {
+				CommandBase *cmd = reinterpret_cast<CommandBase *>(&head->data[read_offset + HEADER_SIZE]);
+				cmd->call();
+
+				if (unlikely(cmd->sync)) {
+					MutexLock lock(mutex);
+					*static_cast<SyncCommand *>(cmd)->done = true;
+					sync_cond_var.notify_all();
+				}
+
+				cmd->~CommandBase();
+
+				read_offset += size;
+				read_position.store(read_position.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+				continue;
+			}
+		} else if (reserved <= BLOCK_SIZE) {
+			break; // Caught up with the producers.
+		}
+
+		// The block is full, move on to the next one once it's linked.
+		Block *next = head->next.load(std::memory_order_acquire);
+		for (uint32_t spins = 0; unlikely(!next); spins++) {
+			if (spins > 64) {
+				OS::get_singleton()->delay_usec(1);
+			}
+			next = head->next.load(std::memory_order_acquire);
+		}
+
+		// Nothing writes to a full block, so it can be cleared for reuse right away.
+		Block *retired = head;
+		memset(retired->data, 0, BLOCK_SIZE);
+		head = next;
+		read_offset = 0;
+		read_position.store(head->index.load(std::memory_order_relaxed) * BLOCK_SIZE, std::memory_order_relaxed);
+
+		MutexLock lock(mutex);
+		retired->next.store(free_blocks, std::memory_order_relaxed);
+		free_blocks = retired;
+	}
+
+	flush_thread.store(Thread::UNASSIGNED_ID, std::memory_order_relaxed);
+}
+
+void CommandQueueMT::_wait_for_sync(bool &p_done) {
+	MutexLock lock(mutex);
+	if (p_done) {
+		return;
+	}
+
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+	do {
+		sync_cond_var.wait(lock);
+	} while (!p_done);
+	total_stall_usec.fetch_add(OS::get_singleton()->get_ticks_usec() - start, std::memory_order_relaxed);
+}
+
+uint64_t CommandQueueMT::get_total_pending_bytes() {
+	MutexLock lock(queues_mutex);
+	uint64_t bytes = 0;
+	for (const CommandQueueMT *queue : queues) {
+		bytes += queue->get_pending_bytes();
+	}
+	return bytes;
+}
+
 CommandQueueMT::CommandQueueMT() {
-	command_mem.reserve(DEFAULT_COMMAND_MEM_SIZE_KB * 1024);
+	head = _alloc_block();
+	tail.store(head, std::memory_order_relaxed);
+
+	MutexLock lock(queues_mutex);
+	queues.push_back(this);
 }
 
 CommandQueueMT::~CommandQueueMT() {
+	{
+		MutexLock lock(queues_mutex);
+		queues.erase(this);
+	}
+
+	Block *block = head;
+	while (block) {
+		Block *next = block->next.load(std::memory_order_relaxed);
+		memfree(block);
+		block = next;
+	}
+	while (free_blocks) {
+		block = free_blocks;
+		free_blocks = block->next.load(std::memory_order_relaxed);
+		memfree(block);
+	}
 }
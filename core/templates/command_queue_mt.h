@@ -35,11 +35,14 @@
 #include "core/os/condition_variable.h"
 #include "core/os/memory.h"
 #include "core/os/mutex.h"
+#include "core/os/thread.h"
 #include "core/string/print_string.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/simple_type.h"
 #include "core/typedefs.h"
 
+#include <atomic>
+
 #define COMMA(N) _COMMA_##N
 #define _COMMA_0
 #define _COMMA_1 ,
@@ -248,17 +251,14 @@
 #define CMD_TYPE(N) Command##N<T, M COMMA(N) COMMA_SEP_LIST(TYPE_ARG, N)>
 #define CMD_ASSIGN_PARAM(N) cmd->p##N = p##N
 
-#define DECL_PUSH(N)                                                            \
-	template <typename T, typename M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>    \
-	void push(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) {    \
-		MutexLock mlock(mutex);                                                 \
-		CMD_TYPE(N) *cmd = allocate<CMD_TYPE(N)>();                             \
-		cmd->instance = p_instance;                                             \
-		cmd->method = p_method;                                                 \
-		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                    \
-		if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {                \
-			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id); \
-		}                                                                       \
+#define DECL_PUSH(N)                                                         \
+	template <typename T, typename M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)> \
+	void push(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
+		CMD_TYPE(N) *cmd = allocate<CMD_TYPE(N)>();                          \
+		cmd->instance = p_instance;                                          \
+		cmd->method = p_method;                                              \
+		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                 \
+		_publish(cmd);                                                       \
 	}
 
 #define CMD_RET_TYPE(N) CommandRet##N<T, M, COMMA_SEP_LIST(TYPE_ARG, N) COMMA(N) R>
@@ -266,17 +266,15 @@
 #define DECL_PUSH_AND_RET(N)                                                                   \
 	template <typename T, typename M, COMMA_SEP_LIST(TYPE_PARAM, N) COMMA(N) typename R>       \
 	void push_and_ret(T *p_instance, M p_method, COMMA_SEP_LIST(PARAM, N) COMMA(N) R *r_ret) { \
-		MutexLock mlock(mutex);                                                                \
+		bool done = false;                                                                     \
 		CMD_RET_TYPE(N) *cmd = allocate<CMD_RET_TYPE(N)>();                                    \
 		cmd->instance = p_instance;                                                            \
 		cmd->method = p_method;                                                                \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                                   \
 		cmd->ret = r_ret;                                                                      \
-		if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {                               \
-			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);                \
-		}                                                                                      \
-		sync_tail++;                                                                           \
-		_wait_for_sync(mlock);                                                                 \
+		cmd->done = &done;                                                                     \
+		_publish(cmd);                                                                         \
+		_wait_for_sync(done);                                                                  \
 	}
 
 #define CMD_SYNC_TYPE(N) CommandSync##N<T, M COMMA(N) COMMA_SEP_LIST(TYPE_ARG, N)>
@@ -284,16 +282,14 @@
 #define DECL_PUSH_AND_SYNC(N)                                                         \
 	template <typename T, typename M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>          \
 	void push_and_sync(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
-		MutexLock mlock(mutex);                                                       \
+		bool done = false;                                                            \
 		CMD_SYNC_TYPE(N) *cmd = allocate<CMD_SYNC_TYPE(N)>();                         \
 		cmd->instance = p_instance;                                                   \
 		cmd->method = p_method;                                                       \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                          \
-		if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {                      \
-			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);       \
-		}                                                                             \
-		sync_tail++;                                                                  \
-		_wait_for_sync(mlock);                                                        \
+		cmd->done = &done;                                                            \
+		_publish(cmd);                                                                \
+		_wait_for_sync(done);                                                         \
 	}
 
 #define MAX_CMD_PARAMS 15
@@ -306,6 +302,9 @@ class CommandQueueMT {
 	};
 
 	struct SyncCommand : public CommandBase {
+		// Lives on the pushing thread's stack, only accessed with the mutex held.
+		bool *done = nullptr;
+
 		virtual void call() override {}
 		SyncCommand() {
 			sync = true;
@@ -325,86 +324,101 @@ class CommandQueueMT {
 
 	/***** BASE *******/
 
+	// Commands are written into a linked list of fixed-size blocks. Producers claim space with
+	// a single atomic add on the tail block and only take the mutex to link a new block once it
+	// fills up. The consumer reads without any lock, so pushing never waits for commands to run.
+	//
+	// Blocks are recycled but never freed while the queue is alive, so a producer holding a stale
+	// tail pointer can still touch it safely: a retired block stays full until it is linked again,
+	// at which point claims on it are valid ones.
+
 	static const uint32_t DEFAULT_COMMAND_MEM_SIZE_KB = 64;
+	static const uint32_t BLOCK_SIZE = DEFAULT_COMMAND_MEM_SIZE_KB * 1024;
+	// Each command is preceded by an 8-byte header holding its size, which is written last
+	// to publish it. Zero means the command is still being written.
+	static const uint32_t HEADER_SIZE = 8;
+	static const uint32_t END_OF_BLOCK = UINT32_MAX;
+
+	struct Block {
+		// Bytes claimed by producers. Keeps growing past BLOCK_SIZE once the block is full.
+		std::atomic<uint32_t> reserved;
+		std::atomic<Block *> next;
+		// Position of the block in the queue, used to measure its depth.
+		std::atomic<uint64_t> index;
+		alignas(16) uint8_t data[BLOCK_SIZE];
+	};
 
 	BinaryMutex mutex;
-	LocalVector<uint8_t> command_mem;
 	ConditionVariable sync_cond_var;
-	uint32_t sync_head = 0;
-	uint32_t sync_tail = 0;
-	uint32_t sync_awaiters = 0;
-	WorkerThreadPool::TaskID pump_task_id = WorkerThreadPool::INVALID_TASK_ID;
-	uint64_t flush_read_ptr = 0;
+	std::atomic<WorkerThreadPool::TaskID> pump_task_id = WorkerThreadPool::INVALID_TASK_ID;
+	// Set once the pump task has been notified, cleared when it starts flushing.
+	std::atomic<bool> pump_notified = false;
+
+	std::atomic<Block *> tail = nullptr;
+	uint64_t block_count = 0; // Guarded by mutex.
+	Block *free_blocks = nullptr; // Guarded by mutex.
+
+	// Consumer state, only touched with flush_mutex held.
+	BinaryMutex flush_mutex;
+	std::atomic<Thread::ID> flush_thread = Thread::UNASSIGNED_ID;
+	Block *head = nullptr;
+	uint32_t read_offset = 0;
+	// Bytes consumed since the queue was created, readable from any thread.
+	std::atomic<uint64_t> read_position = 0;
+
+	// All live queues, for the Performance monitors.
+	static BinaryMutex queues_mutex;
+	static LocalVector<CommandQueueMT *> queues;
+	static std::atomic<uint64_t> total_stall_usec;
+
+	static _FORCE_INLINE_ std::atomic<uint32_t> *_get_header(Block *p_block, uint32_t p_offset) {
+		return reinterpret_cast<std::atomic<uint32_t> *>(&p_block->data[p_offset]);
+	}
 
 	template <typename T>
 	T *allocate() {
-		// alloc size is size+T+safeguard
-		uint32_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1));
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + 8);
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		T *cmd = memnew_placement(&command_mem[size + 8], T);
-		return cmd;
-	}
-
-	_FORCE_INLINE_ void _prevent_sync_wraparound() {
-		bool safe_to_reset = !sync_awaiters;
-		bool already_sync_to_latest = sync_head == sync_tail;
-		if (safe_to_reset && already_sync_to_latest) {
-			sync_head = 0;
-			sync_tail = 0;
+		// alloc size is header+T, rounded up to keep commands 8-aligned
+		static constexpr uint32_t alloc_size = HEADER_SIZE + ((sizeof(T) + 8 - 1) & ~(8 - 1));
+		static_assert(alloc_size <= BLOCK_SIZE, "Command too large for the command queue.");
+
+		while (true) {
+			Block *block = tail.load(std::memory_order_acquire);
+			// The block may be retired and reused while we hold it, its index tells the uses apart.
+			uint64_t block_index = block->index.load(std::memory_order_acquire);
+			uint32_t offset = block->reserved.fetch_add(alloc_size, std::memory_order_acq_rel);
+			if (likely(offset + alloc_size <= BLOCK_SIZE)) {
+				return memnew_placement(&block->data[offset + HEADER_SIZE], T);
+			}
+			if (offset < BLOCK_SIZE) {
+				// This claim crosses the end of the block, tell the consumer to move on from here.
+				_get_header(block, offset)->store(END_OF_BLOCK, std::memory_order_release);
+			}
+			_add_block(block, block_index);
 		}
 	}
 
-	void _flush() {
-		if (unlikely(flush_read_ptr)) {
-			// Re-entrant call.
-			return;
-		}
-
-		MutexLock lock(mutex);
-
-		while (flush_read_ptr < command_mem.size()) {
-			uint64_t size = *(uint64_t *)&command_mem[flush_read_ptr];
-			flush_read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-			uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(lock);
-			cmd->call();
-			WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
-
-			// Handle potential realloc due to the command and unlock allowance.
-			cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-
-			if (unlikely(cmd->sync)) {
-				sync_head++;
-				lock.~MutexLock(); // Give an opportunity to awaiters right away.
-				sync_cond_var.notify_all();
-				new (&lock) MutexLock(mutex);
-				// Handle potential realloc happened during unlock.
-				cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-			}
-
-			cmd->~CommandBase();
-
-			flush_read_ptr += size;
+	template <typename T>
+	_FORCE_INLINE_ void _publish(T *p_cmd) {
+		std::atomic<uint32_t> *header = reinterpret_cast<std::atomic<uint32_t> *>(reinterpret_cast<uint8_t *>(p_cmd) - HEADER_SIZE);
+		header->store(HEADER_SIZE + ((sizeof(T) + 8 - 1) & ~(8 - 1)), std::memory_order_release);
+
+		// Only the first push after the pump starts flushing needs to wake it up.
+		WorkerThreadPool::TaskID task_id = pump_task_id.load(std::memory_order_relaxed);
+		if (task_id != WorkerThreadPool::INVALID_TASK_ID && !pump_notified.exchange(true, std::memory_order_acq_rel)) {
+			WorkerThreadPool::get_singleton()->notify_yield_over(task_id);
 		}
-
-		command_mem.clear();
-		flush_read_ptr = 0;
-
-		_prevent_sync_wraparound();
 	}
 
-	_FORCE_INLINE_ void _wait_for_sync(MutexLock<BinaryMutex> &p_lock) {
-		sync_awaiters++;
-		uint32_t sync_head_goal = sync_tail;
-		do {
-			sync_cond_var.wait(p_lock);
-		} while (sync_head < sync_head_goal);
-		sync_awaiters--;
-		_prevent_sync_wraparound();
+	_FORCE_INLINE_ uint64_t _get_write_position() const {
+		Block *block = tail.load(std::memory_order_acquire);
+		return block->index.load(std::memory_order_relaxed) * BLOCK_SIZE + MIN(block->reserved.load(std::memory_order_relaxed), BLOCK_SIZE);
 	}
 
+	Block *_alloc_block();
+	void _add_block(Block *p_full_block, uint64_t p_block_index);
+	void _flush();
+	void _wait_for_sync(bool &p_done);
+
 	void _no_op() {}
 
 public:
@@ -421,7 +435,7 @@ public:
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
 
 	_FORCE_INLINE_ void flush_if_pending() {
-		if (unlikely(command_mem.size() > 0)) {
+		if (unlikely(_get_write_position() > read_position.load(std::memory_order_relaxed))) {
 			_flush();
 		}
 	}
@@ -435,14 +449,27 @@ public:
 	}
 
 	void wait_and_flush() {
-		ERR_FAIL_COND(pump_task_id == WorkerThreadPool::INVALID_TASK_ID);
-		WorkerThreadPool::get_singleton()->wait_for_task_completion(pump_task_id);
+		ERR_FAIL_COND(pump_task_id.load(std::memory_order_relaxed) == WorkerThreadPool::INVALID_TASK_ID);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(pump_task_id.load(std::memory_order_relaxed));
 		_flush();
 	}
 
 	void set_pump_task_id(WorkerThreadPool::TaskID p_task_id) {
-		MutexLock lock(mutex);
-		pump_task_id = p_task_id;
+		pump_task_id.store(p_task_id, std::memory_order_relaxed);
+	}
+
+	// Bytes of commands pushed but not flushed yet.
+	_FORCE_INLINE_ uint64_t get_pending_bytes() const {
+		uint64_t written = _get_write_position();
+		uint64_t read = read_position.load(std::memory_order_relaxed);
+		return written > read ? written - read : 0;
+	}
+
+	// Totals over all the queues, for the Performance monitors.
+	static uint64_t get_total_pending_bytes();
+	// Time threads spent waiting for synchronous commands to be run, since startup.
+	static uint64_t get_total_stall_usec() {
+		return total_stall_usec.load(std::memory_order_relaxed);
 	}
 
 	CommandQueueMT();
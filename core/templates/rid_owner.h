@@ -40,6 +40,7 @@
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
 
+#include <atomic>
 #include <stdio.h>
 #include <typeinfo>
 
@@ -63,21 +64,32 @@ protected:
 		return base_id.increment();
 	}
 
+	// Reserves p_count consecutive ids and returns the first one.
+	static uint64_t _gen_ids(uint32_t p_count) {
+		return base_id.add(p_count) - p_count + 1;
+	}
+
 public:
 	virtual ~RID_AllocBase() {}
 };
 
 template <typename T, bool THREAD_SAFE = false>
 class RID_Alloc : public RID_AllocBase {
+	// Lookups don't lock, so in thread-safe owners validators and max_alloc are
+	// published with release semantics once the memory behind them is ready.
+	static constexpr std::memory_order SYNC_ACQUIRE = THREAD_SAFE ? std::memory_order_acquire : std::memory_order_relaxed;
+	static constexpr std::memory_order SYNC_RELEASE = THREAD_SAFE ? std::memory_order_release : std::memory_order_relaxed;
+
 	struct Chunk {
 		T data;
-		uint32_t validator;
+		std::atomic<uint32_t> validator;
 	};
 	Chunk **chunks = nullptr;
 	uint32_t **free_list_chunks = nullptr;
 
 	uint32_t elements_in_chunk;
-	uint32_t max_alloc = 0;
+	// Only grows, and only after the new chunk is fully initialized, so lookups can read it without locking.
+	std::atomic<uint32_t> max_alloc = 0;
 	uint32_t alloc_count = 0;
 	uint32_t chunk_limit = 0;
 
@@ -85,65 +97,165 @@ class RID_Alloc : public RID_AllocBase {
 
 	mutable Mutex mutex;
 
-	_FORCE_INLINE_ RID _allocate_rid() {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
-
-		if (alloc_count == max_alloc) {
-			//allocate a new chunk
-			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
-			if (THREAD_SAFE && chunk_count == chunk_limit) {
-				mutex.unlock();
-				if (description != nullptr) {
-					ERR_FAIL_V_MSG(RID(), vformat("Element limit for RID of type '%s' reached.", String(description)));
-				} else {
-					ERR_FAIL_V_MSG(RID(), "Element limit reached.");
-				}
-			}
-
-			//grow chunks
-			if constexpr (!THREAD_SAFE) {
-				chunks = (Chunk **)memrealloc(chunks, sizeof(Chunk *) * (chunk_count + 1));
-			}
-			chunks[chunk_count] = (Chunk *)memalloc(sizeof(Chunk) * elements_in_chunk); //but don't initialize
-			//grow free lists
-			if constexpr (!THREAD_SAFE) {
-				free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
+	// Must be called with the mutex held.
+	bool _grow() {
+		uint32_t current_max_alloc = max_alloc.load(std::memory_order_relaxed);
+		uint32_t chunk_count = alloc_count == 0 ? 0 : (current_max_alloc / elements_in_chunk);
+		if (THREAD_SAFE && chunk_count == chunk_limit) {
+			if (description != nullptr) {
+				ERR_FAIL_V_MSG(false, vformat("Element limit for RID of type '%s' reached.", String(description)));
+			} else {
+				ERR_FAIL_V_MSG(false, "Element limit reached.");
 			}
-			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
+		}
 
-			//initialize
-			for (uint32_t i = 0; i < elements_in_chunk; i++) {
-				// Don't initialize chunk.
-				chunks[chunk_count][i].validator = 0xFFFFFFFF;
-				free_list_chunks[chunk_count][i] = alloc_count + i;
-			}
+		//grow chunks
+		if constexpr (!THREAD_SAFE) {
+			chunks = (Chunk **)memrealloc(chunks, sizeof(Chunk *) * (chunk_count + 1));
+		}
+		chunks[chunk_count] = (Chunk *)memalloc(sizeof(Chunk) * elements_in_chunk); //but don't initialize
+		//grow free lists
+		if constexpr (!THREAD_SAFE) {
+			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
+		}
+		free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
 
-			max_alloc += elements_in_chunk;
+		//initialize
+		for (uint32_t i = 0; i < elements_in_chunk; i++) {
+			// Don't initialize chunk.
+			new (&chunks[chunk_count][i].validator) std::atomic<uint32_t>(0xFFFFFFFF);
+			free_list_chunks[chunk_count][i] = alloc_count + i;
 		}
 
+		max_alloc.store(current_max_alloc + elements_in_chunk, std::memory_order_release);
+		return true;
+	}
+
+	// Must be called with the mutex held, and with a free slot available.
+	_FORCE_INLINE_ RID _take_free_slot(uint64_t p_id) {
 		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
 
 		uint32_t free_chunk = free_index / elements_in_chunk;
 		uint32_t free_element = free_index % elements_in_chunk;
 
-		uint32_t validator = (uint32_t)(_gen_id() & 0x7FFFFFFF);
+		uint32_t validator = (uint32_t)(p_id & 0x7FFFFFFF);
 		CRASH_COND_MSG(validator == 0x7FFFFFFF, "Overflow in RID validator");
 		uint64_t id = validator;
 		id <<= 32;
 		id |= free_index;
 
-		chunks[free_chunk][free_element].validator = validator;
-		chunks[free_chunk][free_element].validator |= 0x80000000; //mark uninitialized bit
+		chunks[free_chunk][free_element].validator.store(validator | 0x80000000, SYNC_RELEASE); //mark uninitialized bit
 
 		alloc_count++;
 
+		return _make_from_id(id);
+	}
+
+	_FORCE_INLINE_ RID _allocate_rid() {
+		if constexpr (THREAD_SAFE) {
+			mutex.lock();
+		}
+
+		if (alloc_count == max_alloc.load(std::memory_order_relaxed)) {
+			if (unlikely(!_grow())) {
+				if constexpr (THREAD_SAFE) {
+					mutex.unlock();
+				}
+				return RID();
+			}
+		}
+
+		RID rid = _take_free_slot(_gen_id());
+
 		if constexpr (THREAD_SAFE) {
 			mutex.unlock();
 		}
 
-		return _make_from_id(id);
+		return rid;
+	}
+
+	_FORCE_INLINE_ uint32_t _allocate_rids(RID *r_rids, uint32_t p_count) {
+		if constexpr (THREAD_SAFE) {
+			mutex.lock();
+		}
+
+		// Reserve all the validators at once instead of bumping the shared counter per RID.
+		uint64_t first_id = _gen_ids(p_count);
+		uint32_t allocated = 0;
+		for (; allocated < p_count; allocated++) {
+			if (alloc_count == max_alloc.load(std::memory_order_relaxed) && unlikely(!_grow())) {
+				break;
+			}
+			r_rids[allocated] = _take_free_slot(first_id + allocated);
+		}
+
+		if constexpr (THREAD_SAFE) {
+			mutex.unlock();
+		}
+
+		for (uint32_t i = allocated; i < p_count; i++) {
+			r_rids[i] = RID();
+		}
+		return allocated;
+	}
+
+	_FORCE_INLINE_ Chunk *_get_chunk(const RID &p_rid) const {
+		uint64_t id = p_rid.get_id();
+		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
+		if (unlikely(idx >= max_alloc.load(SYNC_ACQUIRE))) {
+			return nullptr;
+		}
+
+		return &chunks[idx / elements_in_chunk][idx % elements_in_chunk];
+	}
+
+	// Returns the element of an allocated but not yet initialized RID.
+	Chunk *_get_uninitialized_chunk(const RID &p_rid) {
+		Chunk *c = _get_chunk(p_rid);
+		ERR_FAIL_NULL_V_MSG(c, nullptr, "Attempting to initialize an invalid RID");
+
+		uint32_t validator = uint32_t(p_rid.get_id() >> 32);
+		uint32_t chunk_validator = c->validator.load(SYNC_ACQUIRE);
+		if (unlikely(!(chunk_validator & 0x80000000))) {
+			ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
+		}
+
+		if (unlikely((chunk_validator & 0x7FFFFFFF) != validator)) {
+			ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
+		}
+
+		return c;
+	}
+
+	_FORCE_INLINE_ void _mark_initialized(Chunk *p_chunk) {
+		// Only the allocating thread touches an uninitialized slot, so this doesn't need to be a read-modify-write.
+		p_chunk->validator.store(p_chunk->validator.load(std::memory_order_relaxed) & 0x7FFFFFFF, SYNC_RELEASE); //initialized
+	}
+
+	_FORCE_INLINE_ void _free_chunk(Chunk &p_chunk, uint32_t p_index) {
+		p_chunk.data.~T();
+		p_chunk.validator.store(0xFFFFFFFF, SYNC_RELEASE); // go invalid
+
+		alloc_count--;
+		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = p_index;
+	}
+
+	// Must be called with the mutex held. Returns false if the RID can't be freed.
+	bool _free_rid(const RID &p_rid) {
+		Chunk *c = _get_chunk(p_rid);
+		ERR_FAIL_NULL_V(c, false);
+
+		uint64_t id = p_rid.get_id();
+		uint32_t validator = uint32_t(id >> 32);
+		uint32_t chunk_validator = c->validator.load(std::memory_order_relaxed);
+		if (unlikely(chunk_validator & 0x80000000)) {
+			ERR_FAIL_V_MSG(false, "Attempted to free an uninitialized or invalid RID");
+		} else if (unlikely(chunk_validator != validator)) {
+			ERR_FAIL_V(false);
+		}
+
+		_free_chunk(*c, uint32_t(id & 0xFFFFFFFF));
+		return true;
 	}
 
 public:
@@ -158,125 +270,93 @@ public:
 		return rid;
 	}
 
+	// Allocates and default-initializes p_count RIDs, taking the lock only once.
+	// If the element limit is reached, the remaining entries are set to a null RID.
+	void make_rids(RID *r_rids, uint32_t p_count) {
+		uint32_t allocated = _allocate_rids(r_rids, p_count);
+		for (uint32_t i = 0; i < allocated; i++) {
+			initialize_rid(r_rids[i]);
+		}
+	}
+
 	//allocate but don't initialize, use initialize_rid afterwards
 	RID allocate_rid() {
 		return _allocate_rid();
 	}
 
-	_FORCE_INLINE_ T *get_or_null(const RID &p_rid, bool p_initialize = false) {
+	// Same as allocate_rid(), for p_count RIDs under a single lock. Returns how many were allocated.
+	uint32_t allocate_rids(RID *r_rids, uint32_t p_count) {
+		return _allocate_rids(r_rids, p_count);
+	}
+
+	// Lock-free. A RID freed or reallocated by another thread fails the validator check instead of returning stale data.
+	_FORCE_INLINE_ T *get_or_null(const RID &p_rid) {
 		if (p_rid == RID()) {
 			return nullptr;
 		}
 
-		uint64_t id = p_rid.get_id();
-		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
+		Chunk *c = _get_chunk(p_rid);
+		if (unlikely(!c)) {
 			return nullptr;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
-		uint32_t validator = uint32_t(id >> 32);
-
-		Chunk &c = chunks[idx_chunk][idx_element];
-		if (unlikely(p_initialize)) {
-			if (unlikely(!(c.validator & 0x80000000))) {
-				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
-			}
-
-			if (unlikely((c.validator & 0x7FFFFFFF) != validator)) {
-				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
-			}
-
-			c.validator &= 0x7FFFFFFF; //initialized
-
-		} else if (unlikely(c.validator != validator)) {
-			if ((c.validator & 0x80000000) && c.validator != 0xFFFFFFFF) {
+		uint32_t validator = uint32_t(p_rid.get_id() >> 32);
+		uint32_t chunk_validator = c->validator.load(SYNC_ACQUIRE);
+		if (unlikely(chunk_validator != validator)) {
+			if ((chunk_validator & 0x80000000) && chunk_validator != 0xFFFFFFFF) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
 		}
 
-		T *ptr = &c.data;
-
-		return ptr;
+		return &c->data;
 	}
 	void initialize_rid(RID p_rid) {
-		T *mem = get_or_null(p_rid, true);
-		ERR_FAIL_NULL(mem);
-		memnew_placement(mem, T);
+		Chunk *c = _get_uninitialized_chunk(p_rid);
+		ERR_FAIL_NULL(c);
+		memnew_placement(&c->data, T);
+		_mark_initialized(c);
 	}
 	void initialize_rid(RID p_rid, const T &p_value) {
-		T *mem = get_or_null(p_rid, true);
-		ERR_FAIL_NULL(mem);
-		memnew_placement(mem, T(p_value));
+		Chunk *c = _get_uninitialized_chunk(p_rid);
+		ERR_FAIL_NULL(c);
+		memnew_placement(&c->data, T(p_value));
+		_mark_initialized(c);
 	}
 
+	// Lock-free, same as get_or_null().
 	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
-
-		uint64_t id = p_rid.get_id();
-		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
+		const Chunk *c = _get_chunk(p_rid);
+		if (unlikely(!c)) {
 			return false;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
+		uint32_t validator = uint32_t(p_rid.get_id() >> 32);
+		return (validator != 0x7FFFFFFF) && (c->validator.load(SYNC_ACQUIRE) & 0x7FFFFFFF) == validator;
+	}
 
-		uint32_t validator = uint32_t(id >> 32);
+	_FORCE_INLINE_ void free(const RID &p_rid) {
+		if constexpr (THREAD_SAFE) {
+			mutex.lock();
+		}
 
-		bool owned = (validator != 0x7FFFFFFF) && (chunks[idx_chunk][idx_element].validator & 0x7FFFFFFF) == validator;
+		_free_rid(p_rid);
 
 		if constexpr (THREAD_SAFE) {
 			mutex.unlock();
 		}
-
-		return owned;
 	}
 
-	_FORCE_INLINE_ void free(const RID &p_rid) {
+	// Frees p_count RIDs, taking the lock only once. Invalid RIDs are reported and skipped.
+	void free_rids(const RID *p_rids, uint32_t p_count) {
 		if constexpr (THREAD_SAFE) {
 			mutex.lock();
 		}
 
-		uint64_t id = p_rid.get_id();
-		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
-			ERR_FAIL();
-		}
-
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
-		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(chunks[idx_chunk][idx_element].validator & 0x80000000)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
-			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID");
-		} else if (unlikely(chunks[idx_chunk][idx_element].validator != validator)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
-			ERR_FAIL();
+		for (uint32_t i = 0; i < p_count; i++) {
+			_free_rid(p_rids[i]);
 		}
 
-		chunks[idx_chunk][idx_element].data.~T();
-		chunks[idx_chunk][idx_element].validator = 0xFFFFFFFF; // go invalid
-
-		alloc_count--;
-		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
-
 		if constexpr (THREAD_SAFE) {
 			mutex.unlock();
 		}
@@ -289,8 +369,9 @@ public:
 		if constexpr (THREAD_SAFE) {
 			mutex.lock();
 		}
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
+		uint32_t current_max_alloc = max_alloc.load(std::memory_order_relaxed);
+		for (size_t i = 0; i < current_max_alloc; i++) {
+			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator.load(std::memory_order_relaxed);
 			if (validator != 0xFFFFFFFF) {
 				p_owned->push_back(_make_from_id((validator << 32) | i));
 			}
@@ -306,8 +387,9 @@ public:
 			mutex.lock();
 		}
 		uint32_t idx = 0;
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
+		uint32_t current_max_alloc = max_alloc.load(std::memory_order_relaxed);
+		for (size_t i = 0; i < current_max_alloc; i++) {
+			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator.load(std::memory_order_relaxed);
 			if (validator != 0xFFFFFFFF) {
 				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
 				idx++;
@@ -333,12 +415,13 @@ public:
 	}
 
 	~RID_Alloc() {
+		uint32_t current_max_alloc = max_alloc.load(std::memory_order_relaxed);
 		if (alloc_count) {
 			print_error(vformat("ERROR: %d RID allocations of type '%s' were leaked at exit.",
 					alloc_count, description ? description : typeid(T).name()));
 
-			for (size_t i = 0; i < max_alloc; i++) {
-				uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
+			for (size_t i = 0; i < current_max_alloc; i++) {
+				uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator.load(std::memory_order_relaxed);
 				if (validator & 0x80000000) {
 					continue; //uninitialized
 				}
@@ -348,7 +431,7 @@ public:
 			}
 		}
 
-		uint32_t chunk_count = max_alloc / elements_in_chunk;
+		uint32_t chunk_count = current_max_alloc / elements_in_chunk;
 		for (uint32_t i = 0; i < chunk_count; i++) {
 			memfree(chunks[i]);
 			memfree(free_list_chunks[i]);
@@ -374,6 +457,10 @@ public:
 		return alloc.allocate_rid();
 	}
 
+	_FORCE_INLINE_ uint32_t allocate_rids(RID *r_rids, uint32_t p_count) {
+		return alloc.allocate_rids(r_rids, p_count);
+	}
+
 	_FORCE_INLINE_ void initialize_rid(RID p_rid, T *p_ptr) {
 		alloc.initialize_rid(p_rid, p_ptr);
 	}
@@ -400,6 +487,10 @@ public:
 		alloc.free(p_rid);
 	}
 
+	_FORCE_INLINE_ void free_rids(const RID *p_rids, uint32_t p_count) {
+		alloc.free_rids(p_rids, p_count);
+	}
+
 	_FORCE_INLINE_ uint32_t get_rid_count() const {
 		return alloc.get_rid_count();
 	}
@@ -432,10 +523,18 @@ public:
 		return alloc.make_rid(p_ptr);
 	}
 
+	_FORCE_INLINE_ void make_rids(RID *r_rids, uint32_t p_count) {
+		alloc.make_rids(r_rids, p_count);
+	}
+
 	_FORCE_INLINE_ RID allocate_rid() {
 		return alloc.allocate_rid();
 	}
 
+	_FORCE_INLINE_ uint32_t allocate_rids(RID *r_rids, uint32_t p_count) {
+		return alloc.allocate_rids(r_rids, p_count);
+	}
+
 	_FORCE_INLINE_ void initialize_rid(RID p_rid) {
 		alloc.initialize_rid(p_rid);
 	}
@@ -456,6 +555,10 @@ public:
 		alloc.free(p_rid);
 	}
 
+	_FORCE_INLINE_ void free_rids(const RID *p_rids, uint32_t p_count) {
+		alloc.free_rids(p_rids, p_count);
+	}
+
 	_FORCE_INLINE_ uint32_t get_rid_count() const {
 		return alloc.get_rid_count();
 	}
@@ -0,0 +1,216 @@
+/**************************************************************************/
+/*  small_vector.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include "core/error/error_macros.h"
+#include "core/os/memory.h"
+
+#include <string.h>
+#include <initializer_list>
+#include <type_traits>
+
+// A LocalVector that stores up to N elements inside the object itself, and only
+// allocates once it grows past that. Meant for short scratch lists (matches, arguments,
+// path components) that are usually small.
+//
+// Like LocalVector, elements are relocated with plain memory copies. Pointers to the
+// elements are invalidated when the vector is copied or moved in memory, even while
+// they are stored inline.
+template <typename T, uint32_t N, typename U = uint32_t>
+class SmallVector {
+	static_assert(N > 0);
+
+	U count = 0;
+	U capacity = N;
+	T *heap = nullptr; // Only used once the elements don't fit inline.
+	alignas(T) uint8_t inline_buffer[sizeof(T) * N];
+
+	_FORCE_INLINE_ T *_data() { return heap ? heap : (T *)inline_buffer; }
+	_FORCE_INLINE_ const T *_data() const { return heap ? heap : (const T *)inline_buffer; }
+
+	void _grow(U p_capacity) {
+		if (heap) {
+			heap = (T *)memrealloc(heap, p_capacity * sizeof(T));
+			CRASH_COND_MSG(!heap, "Out of memory");
+		} else {
+			T *new_heap = (T *)memalloc(p_capacity * sizeof(T));
+			CRASH_COND_MSG(!new_heap, "Out of memory");
+			memcpy((void *)new_heap, inline_buffer, count * sizeof(T));
+			heap = new_heap;
+		}
+		capacity = p_capacity;
+	}
+
+public:
+	_FORCE_INLINE_ T *ptr() { return _data(); }
+	_FORCE_INLINE_ const T *ptr() const { return _data(); }
+
+	_FORCE_INLINE_ U size() const { return count; }
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+	_FORCE_INLINE_ U get_capacity() const { return capacity; }
+	// Whether the elements are stored inside the vector, without any heap allocation.
+	_FORCE_INLINE_ bool is_inline() const { return heap == nullptr; }
+
+	_FORCE_INLINE_ void push_back(T p_elem) {
+		if (unlikely(count == capacity)) {
+			_grow(capacity << 1);
+		}
+
+		if constexpr (!std::is_trivially_constructible_v<T>) {
+			memnew_placement(&_data()[count++], T(p_elem));
+		} else {
+			_data()[count++] = p_elem;
+		}
+	}
+
+	void remove_at(U p_index) {
+		ERR_FAIL_UNSIGNED_INDEX(p_index, count);
+		T *data = _data();
+		count--;
+		for (U i = p_index; i < count; i++) {
+			data[i] = data[i + 1];
+		}
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			data[count].~T();
+		}
+	}
+
+	void remove_at_unordered(U p_index) {
+		ERR_FAIL_UNSIGNED_INDEX(p_index, count);
+		T *data = _data();
+		count--;
+		if (count > p_index) {
+			data[p_index] = data[count];
+		}
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			data[count].~T();
+		}
+	}
+
+	int64_t find(const T &p_val, U p_from = 0) const {
+		const T *data = _data();
+		for (U i = p_from; i < count; i++) {
+			if (data[i] == p_val) {
+				return int64_t(i);
+			}
+		}
+		return -1;
+	}
+
+	bool has(const T &p_val) const {
+		return find(p_val) != -1;
+	}
+
+	_FORCE_INLINE_ void reserve(U p_size) {
+		if (p_size > capacity) {
+			_grow(nearest_power_of_2_templated(p_size));
+		}
+	}
+
+	void resize(U p_size) {
+		if (p_size < count) {
+			if constexpr (!std::is_trivially_destructible_v<T>) {
+				T *data = _data();
+				for (U i = p_size; i < count; i++) {
+					data[i].~T();
+				}
+			}
+			count = p_size;
+		} else if (p_size > count) {
+			if (unlikely(p_size > capacity)) {
+				_grow(nearest_power_of_2_templated(p_size));
+			}
+			if constexpr (!std::is_trivially_constructible_v<T>) {
+				T *data = _data();
+				for (U i = count; i < p_size; i++) {
+					memnew_placement(&data[i], T);
+				}
+			}
+			count = p_size;
+		}
+	}
+
+	_FORCE_INLINE_ void clear() { resize(0); }
+	void reset() {
+		clear();
+		if (heap) {
+			memfree(heap);
+			heap = nullptr;
+			capacity = N;
+		}
+	}
+
+	_FORCE_INLINE_ const T &operator[](U p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return _data()[p_index];
+	}
+	_FORCE_INLINE_ T &operator[](U p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return _data()[p_index];
+	}
+
+	_FORCE_INLINE_ T *begin() { return _data(); }
+	_FORCE_INLINE_ T *end() { return _data() + count; }
+	_FORCE_INLINE_ const T *begin() const { return _data(); }
+	_FORCE_INLINE_ const T *end() const { return _data() + count; }
+
+	_FORCE_INLINE_ SmallVector() {}
+	_FORCE_INLINE_ SmallVector(std::initializer_list<T> p_init) {
+		reserve(p_init.size());
+		for (const T &element : p_init) {
+			push_back(element);
+		}
+	}
+	SmallVector(const SmallVector &p_from) {
+		resize(p_from.size());
+		T *data = _data();
+		for (U i = 0; i < p_from.count; i++) {
+			data[i] = p_from[i];
+		}
+	}
+	void operator=(const SmallVector &p_from) {
+		if (this == &p_from) {
+			return;
+		}
+		resize(p_from.size());
+		T *data = _data();
+		for (U i = 0; i < p_from.count; i++) {
+			data[i] = p_from[i];
+		}
+	}
+
+	_FORCE_INLINE_ ~SmallVector() {
+		reset();
+	}
+};
+
+#endif // SMALL_VECTOR_H
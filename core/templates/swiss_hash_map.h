@@ -0,0 +1,626 @@
+/**************************************************************************/
+/*  swiss_hash_map.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SWISS_HASH_MAP_H
+#define SWISS_HASH_MAP_H
+
+#include "core/templates/hash_map.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SWISS_HASH_MAP_SSE2
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define SWISS_HASH_MAP_NEON
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/**
+ * An open-addressing hash map in the style of SwissTable. Each slot has a one-byte
+ * control tag: full slots store the low 7 bits of the hash, empty and deleted slots
+ * have the high bit set. Lookups compare the tag against a whole group of 16 control
+ * bytes at once (SSE2 or NEON, with a scalar fallback) and only touch the key/value
+ * storage for slots whose tag matches, so most misses never compare a key.
+ *
+ * Elements are stored inline and are relocated when the table grows, so pointers and
+ * iterators are invalidated by insertion. Erasing does not move other elements.
+ *
+ * Iteration order is unspecified and changes when the table is rehashed.
+ *
+ * Use HashMap if:
+ *   - You need to preserve the insertion order.
+ *   - You need to keep pointers to elements while adding new ones.
+ *
+ * Use AHashMap if you need to access elements by index.
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class SwissHashMap {
+public:
+	// Must be a power of two, and at least GROUP_WIDTH.
+	static constexpr uint32_t MIN_CAPACITY = 16;
+	static constexpr uint32_t GROUP_WIDTH = 16;
+
+private:
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+
+	static constexpr int8_t CTRL_EMPTY = -128;
+	static constexpr int8_t CTRL_DELETED = -2;
+	static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+	struct Group {
+#if defined(SWISS_HASH_MAP_SSE2)
+		__m128i ctrl;
+
+		_FORCE_INLINE_ explicit Group(const int8_t *p_ctrl) :
+				ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl))) {}
+
+		_FORCE_INLINE_ uint32_t match(int8_t p_tag) const {
+			return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(p_tag), ctrl));
+		}
+		_FORCE_INLINE_ uint32_t match_empty_or_deleted() const {
+			return (uint32_t)_mm_movemask_epi8(ctrl);
+		}
+#elif defined(SWISS_HASH_MAP_NEON)
+		int8x16_t ctrl;
+
+		static _FORCE_INLINE_ uint32_t _to_mask(uint8x16_t p_cmp) {
+			static const uint8_t bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+			const uint8x16_t masked = vandq_u8(p_cmp, vld1q_u8(bits));
+			return (uint32_t)vaddv_u8(vget_low_u8(masked)) | ((uint32_t)vaddv_u8(vget_high_u8(masked)) << 8);
+		}
+
+		_FORCE_INLINE_ explicit Group(const int8_t *p_ctrl) :
+				ctrl(vld1q_s8(p_ctrl)) {}
+
+		_FORCE_INLINE_ uint32_t match(int8_t p_tag) const {
+			return _to_mask(vceqq_s8(vdupq_n_s8(p_tag), ctrl));
+		}
+		_FORCE_INLINE_ uint32_t match_empty_or_deleted() const {
+			return _to_mask(vcltzq_s8(ctrl));
+		}
+#else
+		int8_t ctrl[GROUP_WIDTH];
+
+		_FORCE_INLINE_ explicit Group(const int8_t *p_ctrl) {
+			memcpy(ctrl, p_ctrl, GROUP_WIDTH);
+		}
+
+		_FORCE_INLINE_ uint32_t match(int8_t p_tag) const {
+			uint32_t mask = 0;
+			for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+				mask |= (uint32_t)(ctrl[i] == p_tag) << i;
+			}
+			return mask;
+		}
+		_FORCE_INLINE_ uint32_t match_empty_or_deleted() const {
+			uint32_t mask = 0;
+			for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+				mask |= (uint32_t)(ctrl[i] < 0) << i;
+			}
+			return mask;
+		}
+#endif
+		_FORCE_INLINE_ uint32_t match_empty() const {
+			return match(CTRL_EMPTY);
+		}
+	};
+
+	// The control array has GROUP_WIDTH trailing bytes mirroring the first ones, so a
+	// group can be loaded at any slot without wrapping around.
+	int8_t *ctrl = nullptr;
+	MapKeyValue *slots = nullptr;
+
+	// Zero until the first insertion, then a power of two.
+	uint32_t capacity = 0;
+	uint32_t num_elements = 0;
+	// Number of empty slots that can still be filled before the table must be rehashed.
+	uint32_t growth_left = 0;
+
+	static _FORCE_INLINE_ uint32_t _ctz(uint32_t p_mask) {
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_ctz(p_mask);
+#elif defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, p_mask);
+		return index;
+#else
+		uint32_t count = 0;
+		while (!(p_mask & 1)) {
+			p_mask >>= 1;
+			count++;
+		}
+		return count;
+#endif
+	}
+
+	// Leading zeros of a non-zero 16-bit group mask.
+	static _FORCE_INLINE_ uint32_t _clz16(uint32_t p_mask) {
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_clz(p_mask) - 16;
+#elif defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse(&index, p_mask);
+		return 15 - index;
+#else
+		uint32_t count = 0;
+		while (!(p_mask & 0x8000)) {
+			p_mask <<= 1;
+			count++;
+		}
+		return count;
+#endif
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_max_load(uint32_t p_capacity) {
+		return p_capacity - p_capacity / 8;
+	}
+
+	static _FORCE_INLINE_ int8_t _get_tag(uint32_t p_hash) {
+		return (int8_t)(p_hash & 0x7F);
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_slots_offset(uint32_t p_capacity) {
+		const uint32_t align = alignof(MapKeyValue);
+		return (p_capacity + GROUP_WIDTH + align - 1) & ~(align - 1);
+	}
+
+	_FORCE_INLINE_ void _set_ctrl(uint32_t p_index, int8_t p_tag) {
+		ctrl[p_index] = p_tag;
+		if (p_index < GROUP_WIDTH) {
+			ctrl[capacity + p_index] = p_tag;
+		}
+	}
+
+	uint32_t _lookup_index(const TKey &p_key, uint32_t p_hash) const {
+		if (unlikely(ctrl == nullptr)) {
+			return INVALID_INDEX; // Failed lookups, no elements.
+		}
+
+		const int8_t tag = _get_tag(p_hash);
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = (p_hash >> 7) & mask;
+		uint32_t stride = 0;
+
+		while (true) {
+			const Group group(ctrl + pos);
+			uint32_t matches = group.match(tag);
+			while (matches) {
+				const uint32_t index = (pos + _ctz(matches)) & mask;
+				if (likely(Comparator::compare(slots[index].key, p_key))) {
+					return index;
+				}
+				matches &= matches - 1;
+			}
+
+			if (likely(group.match_empty())) {
+				return INVALID_INDEX;
+			}
+
+			// Triangular probing visits every group once the table size is a power of two.
+			stride += GROUP_WIDTH;
+			pos = (pos + stride) & mask;
+		}
+	}
+
+	uint32_t _find_free_index(uint32_t p_hash) const {
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = (p_hash >> 7) & mask;
+		uint32_t stride = 0;
+
+		while (true) {
+			const uint32_t free = Group(ctrl + pos).match_empty_or_deleted();
+			if (likely(free)) {
+				return (pos + _ctz(free)) & mask;
+			}
+
+			stride += GROUP_WIDTH;
+			pos = (pos + stride) & mask;
+		}
+	}
+
+	void _allocate(uint32_t p_capacity) {
+		capacity = p_capacity;
+		const uint32_t slots_offset = _get_slots_offset(capacity);
+		uint8_t *data = reinterpret_cast<uint8_t *>(Memory::alloc_static(slots_offset + sizeof(MapKeyValue) * capacity));
+		ctrl = reinterpret_cast<int8_t *>(data);
+		slots = reinterpret_cast<MapKeyValue *>(data + slots_offset);
+		memset(ctrl, CTRL_EMPTY, capacity + GROUP_WIDTH);
+		growth_left = _get_max_load(capacity);
+	}
+
+	void _rehash(uint32_t p_new_capacity) {
+		int8_t *old_ctrl = ctrl;
+		MapKeyValue *old_slots = slots;
+		const uint32_t old_capacity = capacity;
+
+		_allocate(p_new_capacity);
+
+		if (old_ctrl == nullptr) {
+			return;
+		}
+
+		// Elements are relocated with memcpy, same as AHashMap does.
+		for (uint32_t i = 0; i < old_capacity; i++) {
+			if (old_ctrl[i] >= 0) {
+				const uint32_t hash = Hasher::hash(old_slots[i].key);
+				const uint32_t index = _find_free_index(hash);
+				_set_ctrl(index, _get_tag(hash));
+				memcpy((void *)&slots[index], (const void *)&old_slots[i], sizeof(MapKeyValue));
+			}
+		}
+		growth_left -= num_elements;
+
+		Memory::free_static(old_ctrl);
+	}
+
+	void _grow() {
+		if (ctrl == nullptr) {
+			_allocate(MIN_CAPACITY);
+		} else if (num_elements <= _get_max_load(capacity) / 2) {
+			// Mostly tombstones, rehash in place to reclaim them.
+			_rehash(capacity);
+		} else {
+			_rehash(capacity * 2);
+		}
+	}
+
+	uint32_t _insert_element(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(growth_left == 0)) {
+			_grow();
+		}
+
+		const uint32_t index = _find_free_index(p_hash);
+		if (ctrl[index] == CTRL_EMPTY) {
+			growth_left--;
+		}
+		_set_ctrl(index, _get_tag(p_hash));
+		memnew_placement(&slots[index], MapKeyValue(p_key, p_value));
+		num_elements++;
+		return index;
+	}
+
+	void _erase_index(uint32_t p_index) {
+		slots[p_index].key.~TKey();
+		slots[p_index].value.~TValue();
+		num_elements--;
+
+		// If no window of GROUP_WIDTH slots around this one is completely full, no probe
+		// sequence ever went past it and it can be marked empty instead of deleted.
+		const uint32_t mask = capacity - 1;
+		const uint32_t empty_before = Group(ctrl + ((p_index - GROUP_WIDTH) & mask)).match_empty();
+		const uint32_t empty_after = Group(ctrl + p_index).match_empty();
+		if (empty_before && empty_after && _ctz(empty_after) + _clz16(empty_before) < GROUP_WIDTH) {
+			_set_ctrl(p_index, CTRL_EMPTY);
+			growth_left++;
+		} else {
+			_set_ctrl(p_index, CTRL_DELETED);
+		}
+	}
+
+	void _destroy_elements() {
+		if constexpr (!(std::is_trivially_destructible_v<TKey> && std::is_trivially_destructible_v<TValue>)) {
+			for (uint32_t i = 0; i < capacity; i++) {
+				if (ctrl[i] >= 0) {
+					slots[i].key.~TKey();
+					slots[i].value.~TValue();
+				}
+			}
+		}
+	}
+
+	void _init_from(const SwissHashMap &p_other) {
+		if (p_other.num_elements == 0) {
+			return;
+		}
+
+		_allocate(p_other.capacity);
+		memcpy(ctrl, p_other.ctrl, capacity + GROUP_WIDTH);
+		for (uint32_t i = 0; i < capacity; i++) {
+			if (ctrl[i] >= 0) {
+				memnew_placement(&slots[i], MapKeyValue(p_other.slots[i]));
+			}
+		}
+		num_elements = p_other.num_elements;
+		growth_left = p_other.growth_left;
+	}
+
+public:
+	/* Standard Godot Container API */
+
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (ctrl == nullptr || num_elements == 0) {
+			return;
+		}
+
+		_destroy_elements();
+		memset(ctrl, CTRL_EMPTY, capacity + GROUP_WIDTH);
+		growth_left = _get_max_load(capacity);
+		num_elements = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		const uint32_t index = _lookup_index(p_key, Hasher::hash(p_key));
+		CRASH_COND_MSG(index == INVALID_INDEX, "SwissHashMap key not found.");
+		return slots[index].value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		const uint32_t index = _lookup_index(p_key, Hasher::hash(p_key));
+		CRASH_COND_MSG(index == INVALID_INDEX, "SwissHashMap key not found.");
+		return slots[index].value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		const uint32_t index = _lookup_index(p_key, Hasher::hash(p_key));
+		if (index != INVALID_INDEX) {
+			return &slots[index].value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		const uint32_t index = _lookup_index(p_key, Hasher::hash(p_key));
+		if (index != INVALID_INDEX) {
+			return &slots[index].value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return _lookup_index(p_key, Hasher::hash(p_key)) != INVALID_INDEX;
+	}
+
+	bool erase(const TKey &p_key) {
+		const uint32_t index = _lookup_index(p_key, Hasher::hash(p_key));
+		if (index == INVALID_INDEX) {
+			return false;
+		}
+		_erase_index(index);
+		return true;
+	}
+
+	// Makes room for at least p_elements elements without rehashing.
+	void reserve(uint32_t p_elements) {
+		uint32_t new_capacity = MAX(MIN_CAPACITY, capacity);
+		while (_get_max_load(new_capacity) < p_elements) {
+			new_capacity *= 2;
+		}
+		if (ctrl == nullptr || new_capacity > capacity) {
+			_rehash(new_capacity);
+		}
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const MapKeyValue &operator*() const {
+			return slots[index];
+		}
+		_FORCE_INLINE_ const MapKeyValue *operator->() const {
+			return &slots[index];
+		}
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			index++;
+			while (index < capacity && ctrl[index] < 0) {
+				index++;
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return index < capacity;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const int8_t *p_ctrl, MapKeyValue *p_slots, uint32_t p_capacity, uint32_t p_index) :
+				ctrl(p_ctrl), slots(p_slots), capacity(p_capacity), index(p_index) {}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		const int8_t *ctrl = nullptr;
+		MapKeyValue *slots = nullptr;
+		uint32_t capacity = 0;
+		uint32_t index = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ MapKeyValue &operator*() const {
+			return slots[index];
+		}
+		_FORCE_INLINE_ MapKeyValue *operator->() const {
+			return &slots[index];
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			index++;
+			while (index < capacity && ctrl[index] < 0) {
+				index++;
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return index < capacity;
+		}
+
+		_FORCE_INLINE_ Iterator(const int8_t *p_ctrl, MapKeyValue *p_slots, uint32_t p_capacity, uint32_t p_index) :
+				ctrl(p_ctrl), slots(p_slots), capacity(p_capacity), index(p_index) {}
+		_FORCE_INLINE_ Iterator() {}
+
+		operator ConstIterator() const {
+			return ConstIterator(ctrl, slots, capacity, index);
+		}
+
+	private:
+		friend class SwissHashMap;
+
+		const int8_t *ctrl = nullptr;
+		MapKeyValue *slots = nullptr;
+		uint32_t capacity = 0;
+		uint32_t index = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		Iterator it(ctrl, slots, capacity, 0);
+		if (capacity && ctrl[0] < 0) {
+			++it;
+		}
+		return it;
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(ctrl, slots, capacity, capacity);
+	}
+
+	Iterator find(const TKey &p_key) {
+		const uint32_t index = _lookup_index(p_key, Hasher::hash(p_key));
+		if (index == INVALID_INDEX) {
+			return end();
+		}
+		return Iterator(ctrl, slots, capacity, index);
+	}
+
+	// Erasing does not move other elements, so iteration can continue past a removed element.
+	void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			_erase_index(p_iter.index);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		ConstIterator it(ctrl, slots, capacity, 0);
+		if (capacity && ctrl[0] < 0) {
+			++it;
+		}
+		return it;
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(ctrl, slots, capacity, capacity);
+	}
+
+	ConstIterator find(const TKey &p_key) const {
+		const uint32_t index = _lookup_index(p_key, Hasher::hash(p_key));
+		if (index == INVALID_INDEX) {
+			return end();
+		}
+		return ConstIterator(ctrl, slots, capacity, index);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		const uint32_t index = _lookup_index(p_key, Hasher::hash(p_key));
+		CRASH_COND(index == INVALID_INDEX);
+		return slots[index].value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		const uint32_t hash = Hasher::hash(p_key);
+		uint32_t index = _lookup_index(p_key, hash);
+		if (index == INVALID_INDEX) {
+			index = _insert_element(p_key, TValue(), hash);
+		}
+		return slots[index].value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		const uint32_t hash = Hasher::hash(p_key);
+		uint32_t index = _lookup_index(p_key, hash);
+		if (index == INVALID_INDEX) {
+			index = _insert_element(p_key, p_value, hash);
+		} else {
+			slots[index].value = p_value;
+		}
+		return Iterator(ctrl, slots, capacity, index);
+	}
+
+	// Inserts an element without checking if it already exists.
+	Iterator insert_new(const TKey &p_key, const TValue &p_value) {
+		DEV_ASSERT(!has(p_key));
+		const uint32_t index = _insert_element(p_key, p_value, Hasher::hash(p_key));
+		return Iterator(ctrl, slots, capacity, index);
+	}
+
+	/* Constructors */
+
+	SwissHashMap(const SwissHashMap &p_other) {
+		_init_from(p_other);
+	}
+
+	void operator=(const SwissHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+
+		reset();
+
+		_init_from(p_other);
+	}
+
+	SwissHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	SwissHashMap() {}
+
+	void reset() {
+		if (ctrl != nullptr) {
+			_destroy_elements();
+			Memory::free_static(ctrl);
+			ctrl = nullptr;
+			slots = nullptr;
+		}
+		capacity = 0;
+		num_elements = 0;
+		growth_left = 0;
+	}
+
+	~SwissHashMap() {
+		reset();
+	}
+};
+
+#endif // SWISS_HASH_MAP_H
@@ -904,7 +904,7 @@ bool Variant::is_zero() const {
 			return *reinterpret_cast<const Vector2i *>(_data._mem) == Vector2i();
 		}
 		case RECT2: {
-			return *reinterpret_cast<const Rect2 *>(_data._mem) == Rect2();
+			return *_real4_ptr<Rect2>() == Rect2();
 		}
 		case RECT2I: {
 			return *reinterpret_cast<const Rect2i *>(_data._mem) == Rect2i();
@@ -919,19 +919,19 @@ bool Variant::is_zero() const {
 			return *reinterpret_cast<const Vector3i *>(_data._mem) == Vector3i();
 		}
 		case VECTOR4: {
-			return *reinterpret_cast<const Vector4 *>(_data._mem) == Vector4();
+			return *_real4_ptr<Vector4>() == Vector4();
 		}
 		case VECTOR4I: {
 			return *reinterpret_cast<const Vector4i *>(_data._mem) == Vector4i();
 		}
 		case PLANE: {
-			return *reinterpret_cast<const Plane *>(_data._mem) == Plane();
+			return *_real4_ptr<Plane>() == Plane();
 		}
 		case AABB: {
 			return *_data._aabb == ::AABB();
 		}
 		case QUATERNION: {
-			return *reinterpret_cast<const Quaternion *>(_data._mem) == Quaternion();
+			return *_real4_ptr<Quaternion>() == Quaternion();
 		}
 		case BASIS: {
 			return *_data._basis == Basis();
@@ -1033,7 +1033,7 @@ bool Variant::is_one() const {
 			return *reinterpret_cast<const Vector2i *>(_data._mem) == Vector2i(1, 1);
 		}
 		case RECT2: {
-			return *reinterpret_cast<const Rect2 *>(_data._mem) == Rect2(1, 1, 1, 1);
+			return *_real4_ptr<Rect2>() == Rect2(1, 1, 1, 1);
 		}
 		case RECT2I: {
 			return *reinterpret_cast<const Rect2i *>(_data._mem) == Rect2i(1, 1, 1, 1);
@@ -1045,13 +1045,13 @@ bool Variant::is_one() const {
 			return *reinterpret_cast<const Vector3i *>(_data._mem) == Vector3i(1, 1, 1);
 		}
 		case VECTOR4: {
-			return *reinterpret_cast<const Vector4 *>(_data._mem) == Vector4(1, 1, 1, 1);
+			return *_real4_ptr<Vector4>() == Vector4(1, 1, 1, 1);
 		}
 		case VECTOR4I: {
 			return *reinterpret_cast<const Vector4i *>(_data._mem) == Vector4i(1, 1, 1, 1);
 		}
 		case PLANE: {
-			return *reinterpret_cast<const Plane *>(_data._mem) == Plane(1, 1, 1, 1);
+			return *_real4_ptr<Plane>() == Plane(1, 1, 1, 1);
 		}
 
 		case COLOR: {
@@ -1164,7 +1164,7 @@ void Variant::reference(const Variant &p_variant) {
 			memnew_placement(_data._mem, Vector2i(*reinterpret_cast<const Vector2i *>(p_variant._data._mem)));
 		} break;
 		case RECT2: {
-			memnew_placement(_data._mem, Rect2(*reinterpret_cast<const Rect2 *>(p_variant._data._mem)));
+			_real4_init<Rect2>(*p_variant._real4_ptr<Rect2>());
 		} break;
 		case RECT2I: {
 			memnew_placement(_data._mem, Rect2i(*reinterpret_cast<const Rect2i *>(p_variant._data._mem)));
@@ -1180,20 +1180,20 @@ void Variant::reference(const Variant &p_variant) {
 			memnew_placement(_data._mem, Vector3i(*reinterpret_cast<const Vector3i *>(p_variant._data._mem)));
 		} break;
 		case VECTOR4: {
-			memnew_placement(_data._mem, Vector4(*reinterpret_cast<const Vector4 *>(p_variant._data._mem)));
+			_real4_init<Vector4>(*p_variant._real4_ptr<Vector4>());
 		} break;
 		case VECTOR4I: {
 			memnew_placement(_data._mem, Vector4i(*reinterpret_cast<const Vector4i *>(p_variant._data._mem)));
 		} break;
 		case PLANE: {
-			memnew_placement(_data._mem, Plane(*reinterpret_cast<const Plane *>(p_variant._data._mem)));
+			_real4_init<Plane>(*p_variant._real4_ptr<Plane>());
 		} break;
 		case AABB: {
 			_data._aabb = (::AABB *)Pools::_bucket_small.alloc();
 			memnew_placement(_data._aabb, ::AABB(*p_variant._data._aabb));
 		} break;
 		case QUATERNION: {
-			memnew_placement(_data._mem, Quaternion(*reinterpret_cast<const Quaternion *>(p_variant._data._mem)));
+			_real4_init<Quaternion>(*p_variant._real4_ptr<Quaternion>());
 		} break;
 		case BASIS: {
 			_data._basis = (Basis *)Pools::_bucket_medium.alloc();
@@ -1325,7 +1325,7 @@ void Variant::zero() {
 			*reinterpret_cast<Vector2i *>(_data._mem) = Vector2i();
 			break;
 		case RECT2:
-			*reinterpret_cast<Rect2 *>(_data._mem) = Rect2();
+			*_real4_ptr<Rect2>() = Rect2();
 			break;
 		case RECT2I:
 			*reinterpret_cast<Rect2i *>(_data._mem) = Rect2i();
@@ -1337,16 +1337,16 @@ void Variant::zero() {
 			*reinterpret_cast<Vector3i *>(_data._mem) = Vector3i();
 			break;
 		case VECTOR4:
-			*reinterpret_cast<Vector4 *>(_data._mem) = Vector4();
+			*_real4_ptr<Vector4>() = Vector4();
 			break;
 		case VECTOR4I:
 			*reinterpret_cast<Vector4i *>(_data._mem) = Vector4i();
 			break;
 		case PLANE:
-			*reinterpret_cast<Plane *>(_data._mem) = Plane();
+			*_real4_ptr<Plane>() = Plane();
 			break;
 		case QUATERNION:
-			*reinterpret_cast<Quaternion *>(_data._mem) = Quaternion();
+			*_real4_ptr<Quaternion>() = Quaternion();
 			break;
 
 		case COLOR:
@@ -1379,6 +1379,18 @@ void Variant::_clear_internal() {
 				_data._transform2d = nullptr;
 			}
 		} break;
+#ifdef VARIANT_REAL4_IN_BUCKET
+		case RECT2:
+		case VECTOR4:
+		case PLANE:
+		case QUATERNION: {
+			// Trivially destructible.
+			if (_data._ptr) {
+				Pools::_bucket_small.free((Pools::BucketSmall *)_data._ptr);
+				_data._ptr = nullptr;
+			}
+		} break;
+#endif
 		case AABB: {
 			if (_data._aabb) {
 				_data._aabb->~AABB();
@@ -1887,7 +1899,7 @@ Variant::operator Vector2() const {
 	} else if (type == VECTOR3I) {
 		return Vector2(reinterpret_cast<const Vector3i *>(_data._mem)->x, reinterpret_cast<const Vector3i *>(_data._mem)->y);
 	} else if (type == VECTOR4) {
-		return Vector2(reinterpret_cast<const Vector4 *>(_data._mem)->x, reinterpret_cast<const Vector4 *>(_data._mem)->y);
+		return Vector2(_real4_ptr<Vector4>()->x, _real4_ptr<Vector4>()->y);
 	} else if (type == VECTOR4I) {
 		return Vector2(reinterpret_cast<const Vector4i *>(_data._mem)->x, reinterpret_cast<const Vector4i *>(_data._mem)->y);
 	} else {
@@ -1905,7 +1917,7 @@ Variant::operator Vector2i() const {
 	} else if (type == VECTOR3I) {
 		return Vector2(reinterpret_cast<const Vector3i *>(_data._mem)->x, reinterpret_cast<const Vector3i *>(_data._mem)->y);
 	} else if (type == VECTOR4) {
-		return Vector2(reinterpret_cast<const Vector4 *>(_data._mem)->x, reinterpret_cast<const Vector4 *>(_data._mem)->y);
+		return Vector2(_real4_ptr<Vector4>()->x, _real4_ptr<Vector4>()->y);
 	} else if (type == VECTOR4I) {
 		return Vector2(reinterpret_cast<const Vector4i *>(_data._mem)->x, reinterpret_cast<const Vector4i *>(_data._mem)->y);
 	} else {
@@ -1915,7 +1927,7 @@ Variant::operator Vector2i() const {
 
 Variant::operator Rect2() const {
 	if (type == RECT2) {
-		return *reinterpret_cast<const Rect2 *>(_data._mem);
+		return *_real4_ptr<Rect2>();
 	} else if (type == RECT2I) {
 		return *reinterpret_cast<const Rect2i *>(_data._mem);
 	} else {
@@ -1927,7 +1939,7 @@ Variant::operator Rect2i() const {
 	if (type == RECT2I) {
 		return *reinterpret_cast<const Rect2i *>(_data._mem);
 	} else if (type == RECT2) {
-		return *reinterpret_cast<const Rect2 *>(_data._mem);
+		return *_real4_ptr<Rect2>();
 	} else {
 		return Rect2i();
 	}
@@ -1943,7 +1955,7 @@ Variant::operator Vector3() const {
 	} else if (type == VECTOR2I) {
 		return Vector3(reinterpret_cast<const Vector2i *>(_data._mem)->x, reinterpret_cast<const Vector2i *>(_data._mem)->y, 0.0);
 	} else if (type == VECTOR4) {
-		return Vector3(reinterpret_cast<const Vector4 *>(_data._mem)->x, reinterpret_cast<const Vector4 *>(_data._mem)->y, reinterpret_cast<const Vector4 *>(_data._mem)->z);
+		return Vector3(_real4_ptr<Vector4>()->x, _real4_ptr<Vector4>()->y, _real4_ptr<Vector4>()->z);
 	} else if (type == VECTOR4I) {
 		return Vector3(reinterpret_cast<const Vector4i *>(_data._mem)->x, reinterpret_cast<const Vector4i *>(_data._mem)->y, reinterpret_cast<const Vector4i *>(_data._mem)->z);
 	} else {
@@ -1961,7 +1973,7 @@ Variant::operator Vector3i() const {
 	} else if (type == VECTOR2I) {
 		return Vector3i(reinterpret_cast<const Vector2i *>(_data._mem)->x, reinterpret_cast<const Vector2i *>(_data._mem)->y, 0.0);
 	} else if (type == VECTOR4) {
-		return Vector3i(reinterpret_cast<const Vector4 *>(_data._mem)->x, reinterpret_cast<const Vector4 *>(_data._mem)->y, reinterpret_cast<const Vector4 *>(_data._mem)->z);
+		return Vector3i(_real4_ptr<Vector4>()->x, _real4_ptr<Vector4>()->y, _real4_ptr<Vector4>()->z);
 	} else if (type == VECTOR4I) {
 		return Vector3i(reinterpret_cast<const Vector4i *>(_data._mem)->x, reinterpret_cast<const Vector4i *>(_data._mem)->y, reinterpret_cast<const Vector4i *>(_data._mem)->z);
 	} else {
@@ -1971,7 +1983,7 @@ Variant::operator Vector3i() const {
 
 Variant::operator Vector4() const {
 	if (type == VECTOR4) {
-		return *reinterpret_cast<const Vector4 *>(_data._mem);
+		return *_real4_ptr<Vector4>();
 	} else if (type == VECTOR4I) {
 		return *reinterpret_cast<const Vector4i *>(_data._mem);
 	} else if (type == VECTOR2) {
@@ -1991,7 +2003,7 @@ Variant::operator Vector4i() const {
 	if (type == VECTOR4I) {
 		return *reinterpret_cast<const Vector4i *>(_data._mem);
 	} else if (type == VECTOR4) {
-		const Vector4 &v4 = *reinterpret_cast<const Vector4 *>(_data._mem);
+		const Vector4 &v4 = *_real4_ptr<Vector4>();
 		return Vector4i(v4.x, v4.y, v4.z, v4.w);
 	} else if (type == VECTOR2) {
 		return Vector4i(reinterpret_cast<const Vector2 *>(_data._mem)->x, reinterpret_cast<const Vector2 *>(_data._mem)->y, 0.0, 0.0);
@@ -2008,7 +2020,7 @@ Variant::operator Vector4i() const {
 
 Variant::operator Plane() const {
 	if (type == PLANE) {
-		return *reinterpret_cast<const Plane *>(_data._mem);
+		return *_real4_ptr<Plane>();
 	} else {
 		return Plane();
 	}
@@ -2026,7 +2038,7 @@ Variant::operator Basis() const {
 	if (type == BASIS) {
 		return *_data._basis;
 	} else if (type == QUATERNION) {
-		return *reinterpret_cast<const Quaternion *>(_data._mem);
+		return *_real4_ptr<Quaternion>();
 	} else if (type == TRANSFORM3D) { // unexposed in Variant::can_convert?
 		return _data._transform3d->basis;
 	} else {
@@ -2036,7 +2048,7 @@ Variant::operator Basis() const {
 
 Variant::operator Quaternion() const {
 	if (type == QUATERNION) {
-		return *reinterpret_cast<const Quaternion *>(_data._mem);
+		return *_real4_ptr<Quaternion>();
 	} else if (type == BASIS) {
 		return *_data._basis;
 	} else if (type == TRANSFORM3D) {
@@ -2052,7 +2064,7 @@ Variant::operator Transform3D() const {
 	} else if (type == BASIS) {
 		return Transform3D(*_data._basis, Vector3());
 	} else if (type == QUATERNION) {
-		return Transform3D(Basis(*reinterpret_cast<const Quaternion *>(_data._mem)), Vector3());
+		return Transform3D(Basis(*_real4_ptr<Quaternion>()), Vector3());
 	} else if (type == TRANSFORM2D) {
 		const Transform2D &t = *_data._transform2d;
 		Transform3D m;
@@ -2076,7 +2088,7 @@ Variant::operator Projection() const {
 	} else if (type == BASIS) {
 		return Transform3D(*_data._basis, Vector3());
 	} else if (type == QUATERNION) {
-		return Transform3D(Basis(*reinterpret_cast<const Quaternion *>(_data._mem)), Vector3());
+		return Transform3D(Basis(*_real4_ptr<Quaternion>()), Vector3());
 	} else if (type == TRANSFORM2D) {
 		const Transform2D &t = *_data._transform2d;
 		Transform3D m;
@@ -2537,7 +2549,7 @@ Variant::Variant(const Vector3i &p_vector3i) :
 
 Variant::Variant(const Vector4 &p_vector4) :
 		type(VECTOR4) {
-	memnew_placement(_data._mem, Vector4(p_vector4));
+	_real4_init<Vector4>(p_vector4);
 }
 
 Variant::Variant(const Vector4i &p_vector4i) :
@@ -2557,7 +2569,7 @@ Variant::Variant(const Vector2i &p_vector2i) :
 
 Variant::Variant(const Rect2 &p_rect2) :
 		type(RECT2) {
-	memnew_placement(_data._mem, Rect2(p_rect2));
+	_real4_init<Rect2>(p_rect2);
 }
 
 Variant::Variant(const Rect2i &p_rect2i) :
@@ -2567,7 +2579,7 @@ Variant::Variant(const Rect2i &p_rect2i) :
 
 Variant::Variant(const Plane &p_plane) :
 		type(PLANE) {
-	memnew_placement(_data._mem, Plane(p_plane));
+	_real4_init<Plane>(p_plane);
 }
 
 Variant::Variant(const ::AABB &p_aabb) :
@@ -2584,7 +2596,7 @@ Variant::Variant(const Basis &p_matrix) :
 
 Variant::Variant(const Quaternion &p_quaternion) :
 		type(QUATERNION) {
-	memnew_placement(_data._mem, Quaternion(p_quaternion));
+	_real4_init<Quaternion>(p_quaternion);
 }
 
 Variant::Variant(const Transform3D &p_transform) :
@@ -2794,7 +2806,7 @@ void Variant::operator=(const Variant &p_variant) {
 			*reinterpret_cast<Vector2i *>(_data._mem) = *reinterpret_cast<const Vector2i *>(p_variant._data._mem);
 		} break;
 		case RECT2: {
-			*reinterpret_cast<Rect2 *>(_data._mem) = *reinterpret_cast<const Rect2 *>(p_variant._data._mem);
+			*_real4_ptr<Rect2>() = *p_variant._real4_ptr<Rect2>();
 		} break;
 		case RECT2I: {
 			*reinterpret_cast<Rect2i *>(_data._mem) = *reinterpret_cast<const Rect2i *>(p_variant._data._mem);
@@ -2809,20 +2821,20 @@ void Variant::operator=(const Variant &p_variant) {
 			*reinterpret_cast<Vector3i *>(_data._mem) = *reinterpret_cast<const Vector3i *>(p_variant._data._mem);
 		} break;
 		case VECTOR4: {
-			*reinterpret_cast<Vector4 *>(_data._mem) = *reinterpret_cast<const Vector4 *>(p_variant._data._mem);
+			*_real4_ptr<Vector4>() = *p_variant._real4_ptr<Vector4>();
 		} break;
 		case VECTOR4I: {
 			*reinterpret_cast<Vector4i *>(_data._mem) = *reinterpret_cast<const Vector4i *>(p_variant._data._mem);
 		} break;
 		case PLANE: {
-			*reinterpret_cast<Plane *>(_data._mem) = *reinterpret_cast<const Plane *>(p_variant._data._mem);
+			*_real4_ptr<Plane>() = *p_variant._real4_ptr<Plane>();
 		} break;
 
 		case AABB: {
 			*_data._aabb = *(p_variant._data._aabb);
 		} break;
 		case QUATERNION: {
-			*reinterpret_cast<Quaternion *>(_data._mem) = *reinterpret_cast<const Quaternion *>(p_variant._data._mem);
+			*_real4_ptr<Quaternion>() = *p_variant._real4_ptr<Quaternion>();
 		} break;
 		case BASIS: {
 			*_data._basis = *(p_variant._data._basis);
@@ -2939,7 +2951,7 @@ uint32_t Variant::recursive_hash(int recursion_count) const {
 			return HashMapHasherDefault::hash(*reinterpret_cast<const Vector2i *>(_data._mem));
 		} break;
 		case RECT2: {
-			return HashMapHasherDefault::hash(*reinterpret_cast<const Rect2 *>(_data._mem));
+			return HashMapHasherDefault::hash(*_real4_ptr<Rect2>());
 		} break;
 		case RECT2I: {
 			return HashMapHasherDefault::hash(*reinterpret_cast<const Rect2i *>(_data._mem));
@@ -2963,14 +2975,14 @@ uint32_t Variant::recursive_hash(int recursion_count) const {
 			return HashMapHasherDefault::hash(*reinterpret_cast<const Vector3i *>(_data._mem));
 		} break;
 		case VECTOR4: {
-			return HashMapHasherDefault::hash(*reinterpret_cast<const Vector4 *>(_data._mem));
+			return HashMapHasherDefault::hash(*_real4_ptr<Vector4>());
 		} break;
 		case VECTOR4I: {
 			return HashMapHasherDefault::hash(*reinterpret_cast<const Vector4i *>(_data._mem));
 		} break;
 		case PLANE: {
 			uint32_t h = HASH_MURMUR3_SEED;
-			const Plane &p = *reinterpret_cast<const Plane *>(_data._mem);
+			const Plane &p = *_real4_ptr<Plane>();
 			h = hash_murmur3_one_real(p.normal.x, h);
 			h = hash_murmur3_one_real(p.normal.y, h);
 			h = hash_murmur3_one_real(p.normal.z, h);
@@ -2982,7 +2994,7 @@ uint32_t Variant::recursive_hash(int recursion_count) const {
 		} break;
 		case QUATERNION: {
 			uint32_t h = HASH_MURMUR3_SEED;
-			const Quaternion &q = *reinterpret_cast<const Quaternion *>(_data._mem);
+			const Quaternion &q = *_real4_ptr<Quaternion>();
 			h = hash_murmur3_one_real(q.x, h);
 			h = hash_murmur3_one_real(q.y, h);
 			h = hash_murmur3_one_real(q.z, h);
@@ -3327,8 +3339,8 @@ bool Variant::hash_compare(const Variant &p_variant, int recursion_count, bool s
 		} break;
 
 		case RECT2: {
-			const Rect2 *l = reinterpret_cast<const Rect2 *>(_data._mem);
-			const Rect2 *r = reinterpret_cast<const Rect2 *>(p_variant._data._mem);
+			const Rect2 *l = _real4_ptr<Rect2>();
+			const Rect2 *r = p_variant._real4_ptr<Rect2>();
 
 			return hash_compare_vector2(l->position, r->position) &&
 					hash_compare_vector2(l->size, r->size);
@@ -3366,8 +3378,8 @@ bool Variant::hash_compare(const Variant &p_variant, int recursion_count, bool s
 			return *l == *r;
 		} break;
 		case VECTOR4: {
-			const Vector4 *l = reinterpret_cast<const Vector4 *>(_data._mem);
-			const Vector4 *r = reinterpret_cast<const Vector4 *>(p_variant._data._mem);
+			const Vector4 *l = _real4_ptr<Vector4>();
+			const Vector4 *r = p_variant._real4_ptr<Vector4>();
 
 			return hash_compare_vector4(*l, *r);
 		} break;
@@ -3379,8 +3391,8 @@ bool Variant::hash_compare(const Variant &p_variant, int recursion_count, bool s
 		} break;
 
 		case PLANE: {
-			const Plane *l = reinterpret_cast<const Plane *>(_data._mem);
-			const Plane *r = reinterpret_cast<const Plane *>(p_variant._data._mem);
+			const Plane *l = _real4_ptr<Plane>();
+			const Plane *r = p_variant._real4_ptr<Plane>();
 
 			return hash_compare_vector3(l->normal, r->normal) &&
 					hash_compare_scalar(l->d, r->d);
@@ -3396,8 +3408,8 @@ bool Variant::hash_compare(const Variant &p_variant, int recursion_count, bool s
 		} break;
 
 		case QUATERNION: {
-			const Quaternion *l = reinterpret_cast<const Quaternion *>(_data._mem);
-			const Quaternion *r = reinterpret_cast<const Quaternion *>(p_variant._data._mem);
+			const Quaternion *l = _real4_ptr<Quaternion>();
+			const Quaternion *r = p_variant._real4_ptr<Quaternion>();
 
 			return hash_compare_quaternion(*l, *r);
 		} break;
@@ -82,6 +82,13 @@ typedef Vector<Vector3> PackedVector3Array;
 typedef Vector<Color> PackedColorArray;
 typedef Vector<Vector4> PackedVector4Array;
 
+// With double precision, Rect2, Vector4, Plane and Quaternion are 32 bytes and make every Variant 40 bytes.
+// The `compact_variant` build option keeps them in the small bucket like Transform2D instead, so a Variant
+// stays 24 bytes. This changes the layout exposed to GDExtension and C#.
+#if defined(COMPACT_VARIANT_ENABLED) && defined(REAL_T_IS_DOUBLE)
+#define VARIANT_REAL4_IN_BUCKET
+#endif
+
 class Variant {
 public:
 	// If this changes the table in variant_op must be updated
@@ -149,6 +156,12 @@ private:
 			~BucketSmall() {}
 			Transform2D _transform2d;
 			::AABB _aabb;
+#ifdef VARIANT_REAL4_IN_BUCKET
+			Rect2 _rect2;
+			Vector4 _vector4;
+			Plane _plane;
+			Quaternion _quaternion;
+#endif
 		};
 		union BucketMedium {
 			BucketMedium() {}
@@ -268,9 +281,40 @@ private:
 		Projection *_projection;
 		PackedArrayRefBase *packed_array;
 		void *_ptr; //generic pointer
+#ifdef VARIANT_REAL4_IN_BUCKET
+		uint8_t _mem[sizeof(ObjData) > (sizeof(float) * 4) ? sizeof(ObjData) : (sizeof(float) * 4)]{ 0 };
+#else
 		uint8_t _mem[sizeof(ObjData) > (sizeof(real_t) * 4) ? sizeof(ObjData) : (sizeof(real_t) * 4)]{ 0 };
+#endif
 	} _data alignas(8);
 
+	// Storage of the types four `real_t` wide, see `VARIANT_REAL4_IN_BUCKET`.
+	template <typename T>
+	_ALWAYS_INLINE_ T *_real4_ptr() {
+#ifdef VARIANT_REAL4_IN_BUCKET
+		return static_cast<T *>(_data._ptr);
+#else
+		return reinterpret_cast<T *>(_data._mem);
+#endif
+	}
+	template <typename T>
+	_ALWAYS_INLINE_ const T *_real4_ptr() const {
+#ifdef VARIANT_REAL4_IN_BUCKET
+		return static_cast<const T *>(_data._ptr);
+#else
+		return reinterpret_cast<const T *>(_data._mem);
+#endif
+	}
+	template <typename T>
+	_ALWAYS_INLINE_ void _real4_init(const T &p_value) {
+#ifdef VARIANT_REAL4_IN_BUCKET
+		_data._ptr = Pools::_bucket_small.alloc();
+		memnew_placement(_data._ptr, T(p_value));
+#else
+		memnew_placement(_data._mem, T(p_value));
+#endif
+	}
+
 	void reference(const Variant &p_variant);
 
 	void _clear_internal();
@@ -284,15 +328,31 @@ private:
 			true, //STRING,
 			false, //VECTOR2,
 			false, //VECTOR2I,
+#ifdef VARIANT_REAL4_IN_BUCKET
+			true, //RECT2,
+#else
 			false, //RECT2,
+#endif
 			false, //RECT2I,
 			false, //VECTOR3,
 			false, //VECTOR3I,
 			true, //TRANSFORM2D,
+#ifdef VARIANT_REAL4_IN_BUCKET
+			true, //VECTOR4,
+#else
 			false, //VECTOR4,
+#endif
 			false, //VECTOR4I,
+#ifdef VARIANT_REAL4_IN_BUCKET
+			true, //PLANE,
+#else
 			false, //PLANE,
+#endif
+#ifdef VARIANT_REAL4_IN_BUCKET
+			true, //QUATERNION,
+#else
 			false, //QUATERNION,
+#endif
 			true, //AABB,
 			true, //BASIS,
 			true, //TRANSFORM,
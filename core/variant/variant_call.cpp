@@ -38,6 +38,7 @@
 #include "core/os/os.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
+#include "core/templates/small_vector.h"
 
 typedef void (*VariantFunc)(Variant &r_ret, Variant &p_self, const Variant **p_args);
 typedef void (*VariantConstructFunc)(Variant &r_ret, const Variant **p_args);
@@ -559,8 +560,8 @@ static _FORCE_INLINE_ void vc_ptrcall(void (*method)(T *, P...), void *p_base, c
 			m_method_ptr(base, p_args, p_argcount, *r_ret, ce);                                                                                                   \
 		}                                                                                                                                                         \
 		static void ptrcall(void *p_base, const void **p_args, void *r_ret, int p_argcount) {                                                                     \
-			LocalVector<Variant> vars;                                                                                                                            \
-			LocalVector<const Variant *> vars_ptrs;                                                                                                               \
+			SmallVector<Variant, 8> vars;                                                                                                                         \
+			SmallVector<const Variant *, 8> vars_ptrs;                                                                                                            \
 			vars.resize(p_argcount);                                                                                                                              \
 			vars_ptrs.resize(p_argcount);                                                                                                                         \
 			for (int i = 0; i < p_argcount; i++) {                                                                                                                \
@@ -615,8 +616,8 @@ static _FORCE_INLINE_ void vc_ptrcall(void (*method)(T *, P...), void *p_base, c
 			m_method_ptr(base, p_args, p_argcount, *r_ret, ce);                                                                                                   \
 		}                                                                                                                                                         \
 		static void ptrcall(void *p_base, const void **p_args, void *r_ret, int p_argcount) {                                                                     \
-			LocalVector<Variant> vars;                                                                                                                            \
-			LocalVector<const Variant *> vars_ptrs;                                                                                                               \
+			SmallVector<Variant, 8> vars;                                                                                                                         \
+			SmallVector<const Variant *, 8> vars_ptrs;                                                                                                            \
 			vars.resize(p_argcount);                                                                                                                              \
 			vars_ptrs.resize(p_argcount);                                                                                                                         \
 			for (int i = 0; i < p_argcount; i++) {                                                                                                                \
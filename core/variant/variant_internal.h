@@ -51,6 +51,20 @@ public:
 			case Variant::STRING:
 				init_string(v);
 				break;
+#ifdef VARIANT_REAL4_IN_BUCKET
+			case Variant::RECT2:
+				init_rect2(v);
+				break;
+			case Variant::VECTOR4:
+				init_vector4(v);
+				break;
+			case Variant::PLANE:
+				init_plane(v);
+				break;
+			case Variant::QUATERNION:
+				init_quaternion(v);
+				break;
+#endif
 			case Variant::TRANSFORM2D:
 				init_transform2d(v);
 				break;
@@ -140,24 +154,24 @@ public:
 	_FORCE_INLINE_ static const Vector2 *get_vector2(const Variant *v) { return reinterpret_cast<const Vector2 *>(v->_data._mem); }
 	_FORCE_INLINE_ static Vector2i *get_vector2i(Variant *v) { return reinterpret_cast<Vector2i *>(v->_data._mem); }
 	_FORCE_INLINE_ static const Vector2i *get_vector2i(const Variant *v) { return reinterpret_cast<const Vector2i *>(v->_data._mem); }
-	_FORCE_INLINE_ static Rect2 *get_rect2(Variant *v) { return reinterpret_cast<Rect2 *>(v->_data._mem); }
-	_FORCE_INLINE_ static const Rect2 *get_rect2(const Variant *v) { return reinterpret_cast<const Rect2 *>(v->_data._mem); }
+	_FORCE_INLINE_ static Rect2 *get_rect2(Variant *v) { return v->_real4_ptr<Rect2>(); }
+	_FORCE_INLINE_ static const Rect2 *get_rect2(const Variant *v) { return v->_real4_ptr<Rect2>(); }
 	_FORCE_INLINE_ static Rect2i *get_rect2i(Variant *v) { return reinterpret_cast<Rect2i *>(v->_data._mem); }
 	_FORCE_INLINE_ static const Rect2i *get_rect2i(const Variant *v) { return reinterpret_cast<const Rect2i *>(v->_data._mem); }
 	_FORCE_INLINE_ static Vector3 *get_vector3(Variant *v) { return reinterpret_cast<Vector3 *>(v->_data._mem); }
 	_FORCE_INLINE_ static const Vector3 *get_vector3(const Variant *v) { return reinterpret_cast<const Vector3 *>(v->_data._mem); }
 	_FORCE_INLINE_ static Vector3i *get_vector3i(Variant *v) { return reinterpret_cast<Vector3i *>(v->_data._mem); }
 	_FORCE_INLINE_ static const Vector3i *get_vector3i(const Variant *v) { return reinterpret_cast<const Vector3i *>(v->_data._mem); }
-	_FORCE_INLINE_ static Vector4 *get_vector4(Variant *v) { return reinterpret_cast<Vector4 *>(v->_data._mem); }
-	_FORCE_INLINE_ static const Vector4 *get_vector4(const Variant *v) { return reinterpret_cast<const Vector4 *>(v->_data._mem); }
+	_FORCE_INLINE_ static Vector4 *get_vector4(Variant *v) { return v->_real4_ptr<Vector4>(); }
+	_FORCE_INLINE_ static const Vector4 *get_vector4(const Variant *v) { return v->_real4_ptr<Vector4>(); }
 	_FORCE_INLINE_ static Vector4i *get_vector4i(Variant *v) { return reinterpret_cast<Vector4i *>(v->_data._mem); }
 	_FORCE_INLINE_ static const Vector4i *get_vector4i(const Variant *v) { return reinterpret_cast<const Vector4i *>(v->_data._mem); }
 	_FORCE_INLINE_ static Transform2D *get_transform2d(Variant *v) { return v->_data._transform2d; }
 	_FORCE_INLINE_ static const Transform2D *get_transform2d(const Variant *v) { return v->_data._transform2d; }
-	_FORCE_INLINE_ static Plane *get_plane(Variant *v) { return reinterpret_cast<Plane *>(v->_data._mem); }
-	_FORCE_INLINE_ static const Plane *get_plane(const Variant *v) { return reinterpret_cast<const Plane *>(v->_data._mem); }
-	_FORCE_INLINE_ static Quaternion *get_quaternion(Variant *v) { return reinterpret_cast<Quaternion *>(v->_data._mem); }
-	_FORCE_INLINE_ static const Quaternion *get_quaternion(const Variant *v) { return reinterpret_cast<const Quaternion *>(v->_data._mem); }
+	_FORCE_INLINE_ static Plane *get_plane(Variant *v) { return v->_real4_ptr<Plane>(); }
+	_FORCE_INLINE_ static const Plane *get_plane(const Variant *v) { return v->_real4_ptr<Plane>(); }
+	_FORCE_INLINE_ static Quaternion *get_quaternion(Variant *v) { return v->_real4_ptr<Quaternion>(); }
+	_FORCE_INLINE_ static const Quaternion *get_quaternion(const Variant *v) { return v->_real4_ptr<Quaternion>(); }
 	_FORCE_INLINE_ static ::AABB *get_aabb(Variant *v) { return v->_data._aabb; }
 	_FORCE_INLINE_ static const ::AABB *get_aabb(const Variant *v) { return v->_data._aabb; }
 	_FORCE_INLINE_ static Basis *get_basis(Variant *v) { return v->_data._basis; }
@@ -219,8 +233,20 @@ public:
 
 	// Should be in the same order as Variant::Type for consistency.
 	// Those primitive and vector types don't need an `init_` method:
-	// Nil, bool, float, Vector2/i, Rect2/i, Vector3/i, Plane, Quat, RID.
+	// Nil, bool, float, Vector2/i, Rect2i, Vector3/i, RID.
+	// Rect2, Vector4, Plane and Quaternion only need one with `VARIANT_REAL4_IN_BUCKET`.
 	// Object is a special case, handled via `object_reset_data`.
+	template <typename T>
+	_FORCE_INLINE_ static void init_real4(Variant *v) {
+#ifdef VARIANT_REAL4_IN_BUCKET
+		v->_real4_init<T>(T());
+#endif
+		v->type = GetTypeInfo<T>::VARIANT_TYPE;
+	}
+	_FORCE_INLINE_ static void init_rect2(Variant *v) { init_real4<Rect2>(v); }
+	_FORCE_INLINE_ static void init_vector4(Variant *v) { init_real4<Vector4>(v); }
+	_FORCE_INLINE_ static void init_plane(Variant *v) { init_real4<Plane>(v); }
+	_FORCE_INLINE_ static void init_quaternion(Variant *v) { init_real4<Quaternion>(v); }
 	_FORCE_INLINE_ static void init_string(Variant *v) {
 		memnew_placement(v->_data._mem, String);
 		v->type = Variant::STRING;
@@ -1181,7 +1207,7 @@ struct VariantInitializer<Vector2i> {
 
 template <>
 struct VariantInitializer<Rect2> {
-	static _FORCE_INLINE_ void init(Variant *v) { VariantInternal::init_generic<Rect2>(v); }
+	static _FORCE_INLINE_ void init(Variant *v) { VariantInternal::init_rect2(v); }
 };
 
 template <>
@@ -1200,7 +1226,7 @@ struct VariantInitializer<Vector3i> {
 };
 template <>
 struct VariantInitializer<Vector4> {
-	static _FORCE_INLINE_ void init(Variant *v) { VariantInternal::init_generic<Vector4>(v); }
+	static _FORCE_INLINE_ void init(Variant *v) { VariantInternal::init_vector4(v); }
 };
 
 template <>
@@ -1214,12 +1240,12 @@ struct VariantInitializer<Transform2D> {
 
 template <>
 struct VariantInitializer<Plane> {
-	static _FORCE_INLINE_ void init(Variant *v) { VariantInternal::init_generic<Plane>(v); }
+	static _FORCE_INLINE_ void init(Variant *v) { VariantInternal::init_plane(v); }
 };
 
 template <>
 struct VariantInitializer<Quaternion> {
-	static _FORCE_INLINE_ void init(Variant *v) { VariantInternal::init_generic<Quaternion>(v); }
+	static _FORCE_INLINE_ void init(Variant *v) { VariantInternal::init_quaternion(v); }
 };
 
 template <>
@@ -38,6 +38,10 @@
 
 Error ImageLoaderPNG::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitField<ImageFormatLoader::LoaderFlags> p_flags, float p_scale) {
 	const uint64_t buffer_size = f->get_length();
+	const uint8_t *span = f->get_mapped_span(buffer_size);
+	if (span) {
+		return PNGDriverCommon::png_to_image(span, buffer_size, p_flags & FLAG_FORCE_LINEAR, p_image);
+	}
 	Vector<uint8_t> file_buffer;
 	Error err = file_buffer.resize(buffer_size);
 	if (err) {
@@ -269,6 +269,13 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+void FileAccessUnix::prefetch(uint64_t p_offset, uint64_t p_length) const {
+	ERR_FAIL_NULL_MSG(f, "File must be opened before use.");
+#ifdef POSIX_FADV_WILLNEED
+	posix_fadvise(fileno(f), p_offset, p_length, POSIX_FADV_WILLNEED);
+#endif
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
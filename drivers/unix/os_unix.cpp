@@ -70,12 +70,14 @@
 
 #include <dlfcn.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <poll.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/time.h>
@@ -104,10 +106,6 @@
 #define UNIX_GET_ENTROPY
 #endif
 
-#if !defined(UNIX_GET_ENTROPY) && !defined(NO_URANDOM)
-#include <fcntl.h>
-#endif
-
 /// Clock Setup function (used by get_ticks_usec)
 static uint64_t _clock_start = 0;
 #if defined(__APPLE__)
@@ -1041,6 +1039,41 @@ String OS_Unix::get_executable_path() const {
 #endif
 }
 
+const uint8_t *OS_Unix::map_file(const String &p_path, uint64_t &r_length) const {
+	int fd = ::open(p_path.utf8().get_data(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return nullptr;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+		::close(fd);
+		return nullptr;
+	}
+
+	void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd); // The mapping keeps the file referenced.
+	if (data == MAP_FAILED) {
+		return nullptr;
+	}
+
+	r_length = st.st_size;
+	return static_cast<const uint8_t *>(data);
+}
+
+void OS_Unix::unmap_file(const uint8_t *p_data, uint64_t p_length) const {
+	ERR_FAIL_NULL(p_data);
+	munmap(const_cast<uint8_t *>(p_data), p_length);
+}
+
+void OS_Unix::prefetch_mapped(const uint8_t *p_data, uint64_t p_length) const {
+	ERR_FAIL_NULL(p_data);
+	// madvise() wants a page aligned start.
+	const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+	const uintptr_t start = uintptr_t(p_data) & ~(page_size - 1);
+	madvise(reinterpret_cast<void *>(start), uintptr_t(p_data) + p_length - start, MADV_WILLNEED);
+}
+
 void UnixTerminalLogger::log_error(const char *p_function, const char *p_file, int p_line, const char *p_code, const char *p_rationale, bool p_editor_notify, ErrorType p_type) {
 	if (!should_log(true)) {
 		return;
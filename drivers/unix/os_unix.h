@@ -104,6 +104,10 @@ public:
 	virtual void initialize_debugging() override;
 
 	virtual String get_executable_path() const override;
+
+	virtual const uint8_t *map_file(const String &p_path, uint64_t &r_length) const override;
+	virtual void unmap_file(const uint8_t *p_data, uint64_t p_length) const override;
+	virtual void prefetch_mapped(const uint8_t *p_data, uint64_t p_length) const override;
 	virtual String get_user_data_dir() const override;
 };
 
@@ -831,7 +831,12 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, uint64_t p_thread
 
 		bool parsed = EditorDebuggerNode::get_singleton()->plugins_capture(this, p_msg, p_data);
 		if (!parsed) {
-			WARN_PRINT("Unknown message: " + p_msg);
+			// These profilers have no view in the editor, their data is only for the plugins that enable them.
+			// Frames already in flight when such a plugin goes away are dropped.
+			const String prefix = p_msg.substr(0, colon_index);
+			if (prefix != "gdscript_sampler" && prefix != "resource_loader") {
+				WARN_PRINT("Unknown message: " + p_msg);
+			}
 		}
 	}
 }
@@ -33,8 +33,9 @@
 #include "core/config/project_settings.h"
 #include "core/crypto/crypto_core.h"
 #include "core/extension/gdextension.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
-#include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION, PACK_FORMAT_VERSION_UNCOMPRESSED
 #include "core/io/zip_io.h"
 #include "core/version.h"
 #include "editor/editor_file_system.h"
@@ -243,6 +244,22 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 		}
 	}
 
+	for (int i = 0; i < pd->compression_filters.size(); ++i) {
+		if (simplified_path.matchn(pd->compression_filters[i]) || simplified_path.trim_prefix("res://").matchn(pd->compression_filters[i])) {
+			sd.compressed = true;
+			break;
+		}
+	}
+
+	// Compressed files are stored as block-compressed streams, so seeking in them only decompresses the blocks read.
+	Vector<uint8_t> compressed_data;
+	if (sd.compressed) {
+		compressed_data = FileAccessCompressed::compress_buffer(p_data.ptr(), p_data.size());
+		// Small or incompressible files are cheaper to keep as they are.
+		sd.compressed = !compressed_data.is_empty() && compressed_data.size() < p_data.size();
+	}
+	const Vector<uint8_t> &stored_data = sd.compressed ? compressed_data : p_data;
+
 	Ref<FileAccessEncrypted> fae;
 	Ref<FileAccess> ftmp = pd->f;
 
@@ -273,7 +290,7 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 	}
 
 	// Store file content.
-	ftmp->store_buffer(p_data.ptr(), p_data.size());
+	ftmp->store_buffer(stored_data.ptr(), stored_data.size());
 
 	if (fae.is_valid()) {
 		ftmp.unref();
@@ -1805,6 +1822,15 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 	pd.f = ftmp;
 	pd.so_files = p_so_files;
 
+	Vector<String> compression_split = p_preset->get_pck_compression_filter().split(",");
+	for (int i = 0; i < compression_split.size(); i++) {
+		String f = compression_split[i].strip_edges();
+		if (f.is_empty()) {
+			continue;
+		}
+		pd.compression_filters.push_back(f);
+	}
+
 	Error err = export_project_files(p_preset, p_debug, p_save_func, p_remove_func, &pd, _pack_add_shared_object);
 
 	// Close temp file.
@@ -1860,8 +1886,13 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 
 	int64_t pck_start_pos = f->get_position();
 
+	bool has_compressed_files = false;
+	for (const SavedData &E : pd.file_ofs) {
+		has_compressed_files = has_compressed_files || E.compressed;
+	}
+
 	f->store_32(PACK_HEADER_MAGIC);
-	f->store_32(PACK_FORMAT_VERSION);
+	f->store_32(has_compressed_files ? PACK_FORMAT_VERSION : PACK_FORMAT_VERSION_UNCOMPRESSED);
 	f->store_32(VERSION_MAJOR);
 	f->store_32(VERSION_MINOR);
 	f->store_32(VERSION_PATCH);
@@ -1975,6 +2006,9 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		if (pd.file_ofs[i].removal) {
 			flags |= PACK_FILE_REMOVAL;
 		}
+		if (pd.file_ofs[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
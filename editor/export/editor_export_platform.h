@@ -83,6 +83,7 @@ private:
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
 		bool removal = false;
 		Vector<uint8_t> md5;
 		CharString path_utf8;
@@ -95,6 +96,7 @@ private:
 	struct PackData {
 		Ref<FileAccess> f;
 		Vector<SavedData> file_ofs;
+		Vector<String> compression_filters;
 		EditorProgress *ep = nullptr;
 		Vector<SharedObject> *so_files = nullptr;
 	};
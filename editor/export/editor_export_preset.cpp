@@ -357,6 +357,15 @@ String EditorExportPreset::get_exclude_filter() const {
 	return exclude_filter;
 }
 
+void EditorExportPreset::set_pck_compression_filter(const String &p_filter) {
+	pck_compression_filter = p_filter;
+	EditorExport::singleton->save_presets();
+}
+
+String EditorExportPreset::get_pck_compression_filter() const {
+	return pck_compression_filter;
+}
+
 void EditorExportPreset::add_export_file(const String &p_path) {
 	selected_files.insert(p_path);
 	EditorExport::singleton->save_presets();
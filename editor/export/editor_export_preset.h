@@ -65,6 +65,7 @@ private:
 	ExportFilter export_filter = EXPORT_ALL_RESOURCES;
 	String include_filter;
 	String exclude_filter;
+	String pck_compression_filter;
 	String export_path;
 
 	String exporter;
@@ -147,6 +148,9 @@ public:
 	void set_exclude_filter(const String &p_exclude);
 	String get_exclude_filter() const;
 
+	void set_pck_compression_filter(const String &p_filter);
+	String get_pck_compression_filter() const;
+
 	void add_patch(const String &p_path, int p_at_pos = -1);
 	void set_patch(int p_index, const String &p_path);
 	String get_patch(int p_index);
@@ -293,6 +293,7 @@ void ProjectExportDialog::_edit_preset(int p_index) {
 	include_filters->set_text(current->get_include_filter());
 	include_label->set_text(_get_resource_export_header(current->get_export_filter()));
 	exclude_filters->set_text(current->get_exclude_filter());
+	pck_compression_filters->set_text(current->get_pck_compression_filter());
 	server_strip_message->set_visible(current->get_export_filter() == EditorExportPreset::EXPORT_CUSTOMIZED);
 
 	patches->clear();
@@ -703,6 +704,7 @@ void ProjectExportDialog::_duplicate_preset() {
 	preset->set_export_filter(current->get_export_filter());
 	preset->set_include_filter(current->get_include_filter());
 	preset->set_exclude_filter(current->get_exclude_filter());
+	preset->set_pck_compression_filter(current->get_pck_compression_filter());
 	preset->set_patches(current->get_patches());
 	preset->set_custom_features(current->get_custom_features());
 
@@ -914,6 +916,7 @@ void ProjectExportDialog::_filter_changed(const String &p_filter) {
 
 	current->set_include_filter(include_filters->get_text());
 	current->set_exclude_filter(exclude_filters->get_text());
+	current->set_pck_compression_filter(pck_compression_filters->get_text());
 }
 
 void ProjectExportDialog::_fill_resource_tree() {
@@ -1555,6 +1558,12 @@ ProjectExportDialog::ProjectExportDialog() {
 			exclude_filters);
 	exclude_filters->connect(SceneStringName(text_changed), callable_mp(this, &ProjectExportDialog::_filter_changed));
 
+	pck_compression_filters = memnew(LineEdit);
+	resources_vb->add_margin_child(
+			TTR("Filters to compress files in the PCK, they can still be read at random offsets\n(comma-separated, e.g: *.json, *.txt, *.scn)"),
+			pck_compression_filters);
+	pck_compression_filters->connect(SceneStringName(text_changed), callable_mp(this, &ProjectExportDialog::_filter_changed));
+
 	// Patch packages.
 
 	VBoxContainer *patch_vb = memnew(VBoxContainer);
@@ -93,6 +93,7 @@ class ProjectExportDialog : public ConfirmationDialog {
 	OptionButton *export_filter = nullptr;
 	LineEdit *include_filters = nullptr;
 	LineEdit *exclude_filters = nullptr;
+	LineEdit *pck_compression_filters = nullptr;
 	Tree *include_files = nullptr;
 	Label *server_strip_message = nullptr;
 	PopupMenu *file_mode_popup = nullptr;
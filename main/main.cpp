@@ -47,10 +47,12 @@
 #include "core/io/ip.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
 #include "core/os/time.h"
 #include "core/register_core_types.h"
 #include "core/string/translation_server.h"
+#include "core/templates/command_queue_mt.h"
 #include "core/version.h"
 #include "drivers/register_driver_types.h"
 #include "main/app_icon.gen.h"
@@ -4308,6 +4310,8 @@ bool Main::is_iterating() {
 static uint64_t physics_process_max = 0;
 static uint64_t process_max = 0;
 static uint64_t navigation_process_max = 0;
+static uint64_t command_queue_stall_max = 0;
+static uint64_t command_queue_stall_total = 0;
 
 // Return false means iterating further, returning true means `OS::run`
 // will terminate the program. In case of failure, the OS exit code needs
@@ -4448,6 +4452,9 @@ bool Main::iteration() {
 
 	process_ticks = OS::get_singleton()->get_ticks_usec() - process_begin;
 	process_max = MAX(process_ticks, process_max);
+	uint64_t stall_total = CommandQueueMT::get_total_stall_usec();
+	command_queue_stall_max = MAX(stall_total - command_queue_stall_total, command_queue_stall_max);
+	command_queue_stall_total = stall_total;
 	uint64_t frame_time = OS::get_singleton()->get_ticks_usec() - ticks;
 
 	for (int i = 0; i < ScriptServer::get_language_count(); i++) {
@@ -4481,9 +4488,11 @@ bool Main::iteration() {
 		performance->set_process_time(USEC_TO_SEC(process_max));
 		performance->set_physics_process_time(USEC_TO_SEC(physics_process_max));
 		performance->set_navigation_process_time(USEC_TO_SEC(navigation_process_max));
+		performance->set_command_queue_stall_time(USEC_TO_SEC(command_queue_stall_max));
 		process_max = 0;
 		physics_process_max = 0;
 		navigation_process_max = 0;
+		command_queue_stall_max = 0;
 
 		frame %= 1000000;
 		frames = 0;
@@ -4491,6 +4500,8 @@ bool Main::iteration() {
 
 	iterating--;
 
+	FrameArena::end_frame();
+
 	if (movie_writer) {
 		movie_writer->add_frame();
 	}
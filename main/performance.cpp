@@ -31,6 +31,7 @@
 #include "performance.h"
 
 #include "core/os/os.h"
+#include "core/templates/command_queue_mt.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
@@ -97,6 +98,10 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SURFACE);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_DRAW);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SPECIALIZATION);
+	BIND_ENUM_CONSTANT(MEMORY_POOL_RESERVED);
+	BIND_ENUM_CONSTANT(MEMORY_POOL_REFILLS);
+	BIND_ENUM_CONSTANT(COMMAND_QUEUE_PENDING);
+	BIND_ENUM_CONSTANT(COMMAND_QUEUE_STALL_TIME);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -153,6 +158,10 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("pipeline/compilations_surface"),
 		PNAME("pipeline/compilations_draw"),
 		PNAME("pipeline/compilations_specialization"),
+		PNAME("memory/pool_reserved"),
+		PNAME("memory/pool_refills"),
+		PNAME("memory/command_queue_pending"),
+		PNAME("time/command_queue_stall"),
 	};
 
 	return names[p_monitor];
@@ -204,6 +213,14 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_PIPELINE_COMPILATIONS_DRAW);
 		case PIPELINE_COMPILATIONS_SPECIALIZATION:
 			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_PIPELINE_COMPILATIONS_SPECIALIZATION);
+		case MEMORY_POOL_RESERVED:
+			return Memory::get_pool_reserved();
+		case MEMORY_POOL_REFILLS:
+			return Memory::get_pool_refill_count();
+		case COMMAND_QUEUE_PENDING:
+			return CommandQueueMT::get_total_pending_bytes();
+		case COMMAND_QUEUE_STALL_TIME:
+			return _command_queue_stall_time;
 		case PHYSICS_2D_ACTIVE_OBJECTS:
 			return PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_ACTIVE_OBJECTS);
 		case PHYSICS_2D_COLLISION_PAIRS:
@@ -296,6 +313,15 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_TIME,
 
 	};
 
@@ -314,6 +340,10 @@ void Performance::set_navigation_process_time(double p_pt) {
 	_navigation_process_time = p_pt;
 }
 
+void Performance::set_command_queue_stall_time(double p_pt) {
+	_command_queue_stall_time = p_pt;
+}
+
 void Performance::add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args) {
 	ERR_FAIL_COND_MSG(has_custom_monitor(p_id), "Custom monitor with id '" + String(p_id) + "' already exists.");
 	_monitor_map.insert(p_id, MonitorCall(p_callable, p_args));
@@ -361,6 +391,7 @@ Performance::Performance() {
 	_process_time = 0;
 	_physics_process_time = 0;
 	_navigation_process_time = 0;
+	_command_queue_stall_time = 0;
 	_monitor_modification_time = 0;
 	singleton = this;
 }
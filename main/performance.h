@@ -51,6 +51,7 @@ class Performance : public Object {
 	double _process_time;
 	double _physics_process_time;
 	double _navigation_process_time;
+	double _command_queue_stall_time;
 
 	class MonitorCall {
 		Callable _callable;
@@ -106,6 +107,10 @@ public:
 		PIPELINE_COMPILATIONS_SURFACE,
 		PIPELINE_COMPILATIONS_DRAW,
 		PIPELINE_COMPILATIONS_SPECIALIZATION,
+		MEMORY_POOL_RESERVED,
+		MEMORY_POOL_REFILLS,
+		COMMAND_QUEUE_PENDING,
+		COMMAND_QUEUE_STALL_TIME,
 		MONITOR_MAX
 	};
 
@@ -123,6 +128,7 @@ public:
 	void set_process_time(double p_pt);
 	void set_physics_process_time(double p_pt);
 	void set_navigation_process_time(double p_pt);
+	void set_command_queue_stall_time(double p_pt);
 
 	void add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args);
 	void remove_custom_monitor(const StringName &p_id);
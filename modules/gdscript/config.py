@@ -3,6 +3,19 @@ def can_build(env, platform):
     return True
 
 
+def get_opts(platform):
+    from SCons.Variables import PathVariable
+
+    return [
+        PathVariable(
+            "gdscript_aot_source",
+            "Path to a C++ file generated by the GDScript export plugin, compiles its functions ahead of time into the engine",
+            "",
+            PathVariable.PathAccept,
+        ),
+    ]
+
+
 def configure(env):
     pass
 
@@ -1592,6 +1592,7 @@ void GDScript::clear(ClearData *p_clear_data) {
 		clear_data->functions.insert(E.value);
 	}
 	member_functions.clear();
+	inline_cache_epoch.set(GDScriptFunction::inline_cache_epoch.increment());
 
 	for (KeyValue<StringName, MemberInfo> &E : member_indices) {
 		clear_data->scripts.insert(E.value.data_type.script_type_ref);
@@ -1760,6 +1761,38 @@ bool GDScriptInstance::set(const StringName &p_name, const Variant &p_value) {
 	return false;
 }
 
+int GDScriptInstance::get_member_index(const StringName &p_name) const {
+	if (unlikely(!script->valid)) {
+		return -1;
+	}
+	const GDScript::MemberInfo *member = script->member_indices.getptr(p_name);
+	if (!member || member->setter || member->getter) {
+		return -1;
+	}
+	// `set_member()` only stores values of the type already held, which must then be enough to satisfy the member type.
+	const GDScriptDataType &type = member->data_type;
+	if (type.has_type && (type.kind != GDScriptDataType::BUILTIN || type.has_container_element_type(0) || type.has_container_element_types())) {
+		return -1;
+	}
+	return member->index;
+}
+
+bool GDScriptInstance::set_member(int p_index, const Variant &p_value) {
+	ERR_FAIL_INDEX_V(p_index, members.size(), false);
+	Variant &member = members.write[p_index];
+	if (member.get_type() != p_value.get_type()) {
+		return false; // Needs the conversion done by `set()`.
+	}
+	member = p_value;
+	return true;
+}
+
+bool GDScriptInstance::get_member(int p_index, Variant &r_ret) const {
+	ERR_FAIL_INDEX_V(p_index, members.size(), false);
+	r_ret = members[p_index];
+	return true;
+}
+
 bool GDScriptInstance::get(const StringName &p_name, Variant &r_ret) const {
 	{
 		HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = script->member_indices.find(p_name);
@@ -2173,6 +2206,10 @@ void GDScriptInstance::reload_members() {
 		member_indices_cache[E.key] = E.value.index;
 	}
 
+	if (owner) {
+		owner->invalidate_property_handles();
+	}
+
 #endif
 }
 
@@ -2381,6 +2418,46 @@ void GDScriptLanguage::finish() {
 	finishing = false;
 }
 
+void GDScriptLanguage::profiling_sample_call_stacks(CallStackSampleFunc p_func, void *p_userdata) {
+	// The threads keep running while their stacks are read, so a frame may be stale by the time it's
+	// reported. Callers must only use the function pointers after checking them with `profiling_resolve_functions()`.
+	LocalVector<GDScriptFunction *> frames;
+	MutexLock lock(call_stacks_mutex);
+	for (const CallStack *call_stack : call_stacks) {
+		// Read once, the owning thread may push or pop while the levels below are read.
+		const int stack_pos = CLAMP(call_stack->stack_pos.load(std::memory_order_relaxed), 0, _debug_max_call_stack);
+		if (stack_pos == 0) {
+			continue;
+		}
+		frames.resize(stack_pos);
+		int frame_count = 0;
+		for (int i = 0; i < stack_pos; i++) {
+			GDScriptFunction *function = call_stack->levels[i].function.load(std::memory_order_relaxed);
+			if (function) {
+				frames[frame_count++] = function;
+			}
+		}
+		if (frame_count > 0) {
+			p_func(p_userdata, call_stack->thread_id, frames.ptr(), frame_count);
+		}
+	}
+}
+
+void GDScriptLanguage::profiling_resolve_functions(HashMap<const GDScriptFunction *, StringName> &r_functions) {
+#ifdef DEBUG_ENABLED
+	MutexLock lock(mutex);
+
+	SelfList<GDScriptFunction> *elem = function_list.first();
+	while (elem) {
+		HashMap<const GDScriptFunction *, StringName>::Iterator E = r_functions.find(elem->self());
+		if (E) {
+			E->value = elem->self()->profile.signature;
+		}
+		elem = elem->next();
+	}
+#endif
+}
+
 void GDScriptLanguage::profiling_start() {
 #ifdef DEBUG_ENABLED
 	MutexLock lock(mutex);
@@ -2398,6 +2475,12 @@ void GDScriptLanguage::profiling_start() {
 		elem->self()->profile.last_frame_total_time = 0;
 		elem->self()->profile.native_calls.clear();
 		elem->self()->profile.last_native_calls.clear();
+		elem->self()->profile.inline_cache_hits.set(0);
+		elem->self()->profile.inline_cache_misses.set(0);
+		elem->self()->profile.frame_inline_cache_hits.set(0);
+		elem->self()->profile.frame_inline_cache_misses.set(0);
+		elem->self()->profile.last_frame_inline_cache_hits = 0;
+		elem->self()->profile.last_frame_inline_cache_misses = 0;
 		elem = elem->next();
 	}
 
@@ -2451,6 +2534,7 @@ int GDScriptLanguage::profiling_get_accumulated_data(ProfilingInfo *p_info_arr,
 			++nat_calls;
 		}
 		p_info_arr[last_non_internal].internal_time = nat_time;
+		current += profiling_get_inline_cache_data(elem->self(), elem->self()->profile.inline_cache_hits.get(), elem->self()->profile.inline_cache_misses.get(), &p_info_arr[current], p_info_max - current);
 		elem = elem->next();
 	}
 #endif
@@ -2491,6 +2575,7 @@ int GDScriptLanguage::profiling_get_frame_data(ProfilingInfo *p_info_arr, int p_
 				++nat_calls;
 			}
 			p_info_arr[last_non_internal].internal_time = nat_time;
+			current += profiling_get_inline_cache_data(elem->self(), elem->self()->profile.last_frame_inline_cache_hits, elem->self()->profile.last_frame_inline_cache_misses, &p_info_arr[current], p_info_max - current);
 		}
 		elem = elem->next();
 	}
@@ -2499,6 +2584,28 @@ int GDScriptLanguage::profiling_get_frame_data(ProfilingInfo *p_info_arr, int p_
 	return current;
 }
 
+int GDScriptLanguage::profiling_get_inline_cache_data(const GDScriptFunction *p_function, uint64_t p_hits, uint64_t p_misses, ProfilingInfo *p_info_arr, int p_info_max) {
+	int current = 0;
+#ifdef DEBUG_ENABLED
+	// Inline cache statistics are reported as pseudo-functions next to the function they belong to,
+	// with the number of hits or misses as the call count.
+	if (p_hits + p_misses == 0) {
+		return 0;
+	}
+	const uint64_t counts[2] = { p_hits, p_misses };
+	const char *suffixes[2] = { " (inline cache hits)", " (inline cache misses)" };
+	for (int i = 0; i < 2 && current < p_info_max; i++) {
+		p_info_arr[current].call_count = counts[i];
+		p_info_arr[current].total_time = 0;
+		p_info_arr[current].self_time = 0;
+		p_info_arr[current].internal_time = 0;
+		p_info_arr[current].signature = String(p_function->profile.signature) + suffixes[i];
+		current++;
+	}
+#endif
+	return current;
+}
+
 void GDScriptLanguage::profiling_collate_native_call_data(bool p_accumulated) {
 #ifdef DEBUG_ENABLED
 	// The same native call can be called from multiple functions, so join them together here.
@@ -2737,10 +2844,14 @@ void GDScriptLanguage::frame() {
 			elem->self()->profile.last_frame_self_time = elem->self()->profile.frame_self_time.get();
 			elem->self()->profile.last_frame_total_time = elem->self()->profile.frame_total_time.get();
 			elem->self()->profile.last_native_calls = elem->self()->profile.native_calls;
+			elem->self()->profile.last_frame_inline_cache_hits = elem->self()->profile.frame_inline_cache_hits.get();
+			elem->self()->profile.last_frame_inline_cache_misses = elem->self()->profile.frame_inline_cache_misses.get();
 			elem->self()->profile.frame_call_count.set(0);
 			elem->self()->profile.frame_self_time.set(0);
 			elem->self()->profile.frame_total_time.set(0);
 			elem->self()->profile.native_calls.clear();
+			elem->self()->profile.frame_inline_cache_hits.set(0);
+			elem->self()->profile.frame_inline_cache_misses.set(0);
 			elem = elem->next();
 		}
 	}
@@ -2938,6 +3049,19 @@ String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_b
 }
 
 thread_local GDScriptLanguage::CallStack GDScriptLanguage::_call_stack;
+Mutex GDScriptLanguage::call_stacks_mutex;
+LocalVector<GDScriptLanguage::CallStack *> GDScriptLanguage::call_stacks;
+
+void GDScriptLanguage::_register_call_stack(CallStack *p_call_stack) {
+	MutexLock lock(call_stacks_mutex);
+	p_call_stack->thread_id = Thread::get_caller_id();
+	call_stacks.push_back(p_call_stack);
+}
+
+void GDScriptLanguage::_unregister_call_stack(CallStack *p_call_stack) {
+	MutexLock lock(call_stacks_mutex);
+	call_stacks.erase(p_call_stack);
+}
 
 GDScriptLanguage::GDScriptLanguage() {
 	calls = 0;
@@ -39,8 +39,12 @@
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_set.h"
 
+#include <atomic>
+
 class GDScriptNativeClass : public RefCounted {
 	GDCLASS(GDScriptNativeClass, RefCounted);
 
@@ -89,6 +93,7 @@ class GDScript : public Script {
 	friend class GDScriptLambdaCallable;
 	friend class GDScriptLambdaSelfCallable;
 	friend class GDScriptLanguage;
+	friend class GDScriptAOT;
 	friend struct GDScriptUtilityFunctionsDefinitions;
 
 	Ref<GDScriptNativeClass> native;
@@ -96,6 +101,18 @@ class GDScript : public Script {
 	GDScript *_base = nullptr; //fast pointer access
 	GDScript *_owner = nullptr; //for subclasses
 
+	// Set whenever the script is compiled or cleared, invalidating the inline caches that resolved names against it.
+	SafeNumeric<uint32_t> inline_cache_epoch;
+	_FORCE_INLINE_ uint32_t _get_inline_cache_epoch() const {
+		// Names also resolve against the base scripts, which can be recompiled on their own.
+		// Epochs are handed out in increasing order, so the largest one changes with any of them.
+		uint32_t epoch = 0;
+		for (const GDScript *scr = this; scr; scr = scr->_base) {
+			epoch = MAX(epoch, scr->inline_cache_epoch.get());
+		}
+		return epoch;
+	}
+
 	// Members are just indices to the instantiated script.
 	HashMap<StringName, MemberInfo> member_indices; // Includes member info of all base GDScript classes.
 	HashSet<StringName> members; // Only members of the current class.
@@ -381,6 +398,10 @@ public:
 	virtual bool property_can_revert(const StringName &p_name) const;
 	virtual bool property_get_revert(const StringName &p_name, Variant &r_ret) const;
 
+	virtual int get_member_index(const StringName &p_name) const;
+	virtual bool set_member(int p_index, const Variant &p_value);
+	virtual bool get_member(int p_index, Variant &r_ret) const;
+
 	virtual void get_method_list(List<MethodInfo> *p_list) const;
 	virtual bool has_method(const StringName &p_method) const;
 
@@ -420,9 +441,11 @@ class GDScriptLanguage : public ScriptLanguage {
 	HashMap<StringName, Variant> named_globals;
 	Vector<int> global_array_empty_indexes;
 
+	// `function` and `stack_pos` are also read by the sampling profiler from another thread, hence atomic.
+	// The owning thread accesses them with relaxed ordering, which costs the same as plain accesses.
 	struct CallLevel {
 		Variant *stack = nullptr;
-		GDScriptFunction *function = nullptr;
+		std::atomic<GDScriptFunction *> function = { nullptr };
 		GDScriptInstance *instance = nullptr;
 		int *ip = nullptr;
 		int *line = nullptr;
@@ -433,10 +456,12 @@ class GDScriptLanguage : public ScriptLanguage {
 	static thread_local String _debug_error;
 	struct CallStack {
 		CallLevel *levels = nullptr;
-		int stack_pos = 0;
+		std::atomic<int> stack_pos = { 0 };
+		Thread::ID thread_id = Thread::UNASSIGNED_ID;
 
 		void free() {
 			if (levels) {
+				_unregister_call_stack(this);
 				memdelete(levels);
 				levels = nullptr;
 			}
@@ -449,6 +474,12 @@ class GDScriptLanguage : public ScriptLanguage {
 	static thread_local CallStack _call_stack;
 	int _debug_max_call_stack = 0;
 
+	// Call stacks of all threads running GDScript, so they can be sampled from another thread.
+	static Mutex call_stacks_mutex;
+	static LocalVector<CallStack *> call_stacks;
+	static void _register_call_stack(CallStack *p_call_stack);
+	static void _unregister_call_stack(CallStack *p_call_stack);
+
 	void _add_global(const StringName &p_name, const Variant &p_value);
 	void _remove_global(const StringName &p_name);
 
@@ -484,25 +515,27 @@ public:
 	_FORCE_INLINE_ void enter_function(GDScriptInstance *p_instance, GDScriptFunction *p_function, Variant *p_stack, int *p_ip, int *p_line) {
 		if (unlikely(_call_stack.levels == nullptr)) {
 			_call_stack.levels = memnew_arr(CallLevel, _debug_max_call_stack + 1);
+			_register_call_stack(&_call_stack);
 		}
 
 		if (EngineDebugger::get_script_debugger()->get_lines_left() > 0 && EngineDebugger::get_script_debugger()->get_depth() >= 0) {
 			EngineDebugger::get_script_debugger()->set_depth(EngineDebugger::get_script_debugger()->get_depth() + 1);
 		}
 
-		if (_call_stack.stack_pos >= _debug_max_call_stack) {
+		const int stack_pos = _call_stack.stack_pos.load(std::memory_order_relaxed);
+		if (stack_pos >= _debug_max_call_stack) {
 			//stack overflow
 			_debug_error = vformat("Stack overflow (stack size: %s). Check for infinite recursion in your script.", _debug_max_call_stack);
 			EngineDebugger::get_script_debugger()->debug(this);
 			return;
 		}
 
-		_call_stack.levels[_call_stack.stack_pos].stack = p_stack;
-		_call_stack.levels[_call_stack.stack_pos].instance = p_instance;
-		_call_stack.levels[_call_stack.stack_pos].function = p_function;
-		_call_stack.levels[_call_stack.stack_pos].ip = p_ip;
-		_call_stack.levels[_call_stack.stack_pos].line = p_line;
-		_call_stack.stack_pos++;
+		_call_stack.levels[stack_pos].stack = p_stack;
+		_call_stack.levels[stack_pos].instance = p_instance;
+		_call_stack.levels[stack_pos].function.store(p_function, std::memory_order_relaxed);
+		_call_stack.levels[stack_pos].ip = p_ip;
+		_call_stack.levels[stack_pos].line = p_line;
+		_call_stack.stack_pos.store(stack_pos + 1, std::memory_order_relaxed);
 	}
 
 	_FORCE_INLINE_ void exit_function() {
@@ -510,23 +543,26 @@ public:
 			EngineDebugger::get_script_debugger()->set_depth(EngineDebugger::get_script_debugger()->get_depth() - 1);
 		}
 
-		if (_call_stack.stack_pos == 0) {
+		const int stack_pos = _call_stack.stack_pos.load(std::memory_order_relaxed);
+		if (stack_pos == 0) {
 			_debug_error = "Stack Underflow (Engine Bug)";
 			EngineDebugger::get_script_debugger()->debug(this);
 			return;
 		}
 
-		_call_stack.stack_pos--;
+		_call_stack.stack_pos.store(stack_pos - 1, std::memory_order_relaxed);
 	}
 
 	virtual Vector<StackInfo> debug_get_current_stack_info() override {
 		Vector<StackInfo> csi;
-		csi.resize(_call_stack.stack_pos);
-		for (int i = 0; i < _call_stack.stack_pos; i++) {
-			csi.write[_call_stack.stack_pos - i - 1].line = _call_stack.levels[i].line ? *_call_stack.levels[i].line : 0;
-			if (_call_stack.levels[i].function) {
-				csi.write[_call_stack.stack_pos - i - 1].func = _call_stack.levels[i].function->get_name();
-				csi.write[_call_stack.stack_pos - i - 1].file = _call_stack.levels[i].function->get_script()->get_script_path();
+		const int stack_pos = _call_stack.stack_pos.load(std::memory_order_relaxed);
+		csi.resize(stack_pos);
+		for (int i = 0; i < stack_pos; i++) {
+			csi.write[stack_pos - i - 1].line = _call_stack.levels[i].line ? *_call_stack.levels[i].line : 0;
+			GDScriptFunction *function = _call_stack.levels[i].function.load(std::memory_order_relaxed);
+			if (function) {
+				csi.write[stack_pos - i - 1].func = function->get_name();
+				csi.write[stack_pos - i - 1].file = function->get_script()->get_script_path();
 			}
 		}
 		return csi;
@@ -616,10 +652,15 @@ public:
 	virtual void get_public_constants(List<Pair<String, Variant>> *p_constants) const override;
 	virtual void get_public_annotations(List<MethodInfo> *p_annotations) const override;
 
+	typedef void (*CallStackSampleFunc)(void *p_userdata, Thread::ID p_thread, GDScriptFunction *const *p_frames, int p_frame_count);
+	void profiling_sample_call_stacks(CallStackSampleFunc p_func, void *p_userdata);
+	void profiling_resolve_functions(HashMap<const GDScriptFunction *, StringName> &r_functions);
+
 	virtual void profiling_start() override;
 	virtual void profiling_stop() override;
 	virtual void profiling_set_save_native_calls(bool p_enable) override;
 	void profiling_collate_native_call_data(bool p_accumulated);
+	int profiling_get_inline_cache_data(const GDScriptFunction *p_function, uint64_t p_hits, uint64_t p_misses, ProfilingInfo *p_info_arr, int p_info_max);
 
 	virtual int profiling_get_accumulated_data(ProfilingInfo *p_info_arr, int p_info_max) override;
 	virtual int profiling_get_frame_data(ProfilingInfo *p_info_arr, int p_info_max) override;
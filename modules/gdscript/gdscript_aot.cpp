@@ -0,0 +1,661 @@
+/**************************************************************************/
+/*  gdscript_aot.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_aot.h"
+
+#include "gdscript.h"
+
+HashMap<uint64_t, GDScriptAOT::Function> GDScriptAOT::functions;
+
+// Changes to the generated code that older sources can't satisfy must bump this.
+static constexpr uint64_t AOT_FORMAT_VERSION = 2;
+
+static const char *type_adjust_types[] = {
+	"bool",
+	"int64_t",
+	"double",
+	"String",
+	"Vector2",
+	"Vector2i",
+	"Rect2",
+	"Rect2i",
+	"Vector3",
+	"Vector3i",
+	"Transform2D",
+	"Vector4",
+	"Vector4i",
+	"Plane",
+	"Quaternion",
+	"AABB",
+	"Basis",
+	"Transform3D",
+	"Projection",
+	"Color",
+	"StringName",
+	"NodePath",
+	"RID",
+	"Object *",
+	"Callable",
+	"Signal",
+	"Dictionary",
+	"Array",
+	"PackedByteArray",
+	"PackedInt32Array",
+	"PackedInt64Array",
+	"PackedFloat32Array",
+	"PackedFloat64Array",
+	"PackedStringArray",
+	"PackedVector2Array",
+	"PackedVector3Array",
+	"PackedColorArray",
+	"PackedVector4Array",
+};
+
+static_assert(sizeof(type_adjust_types) / sizeof(type_adjust_types[0]) == GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY - GDScriptFunction::OPCODE_TYPE_ADJUST_BOOL + 1, "Type adjust opcodes changed, update the table.");
+
+// Size of the instruction at `p_ip`, or 0 if it can't be translated.
+static int _get_instruction_size(const int *p_code, int p_code_size, int p_ip) {
+	int size = 0;
+	const int opcode = p_code[p_ip];
+
+	if (opcode >= GDScriptFunction::OPCODE_TYPE_ADJUST_BOOL && opcode <= GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY) {
+		size = 2;
+	} else {
+		switch (opcode) {
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED:
+			// Fused pairs are translated as their first instruction; the second one follows as usual.
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF:
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT:
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_ASSIGN:
+			case GDScriptFunction::OPCODE_SET_KEYED_VALIDATED:
+			case GDScriptFunction::OPCODE_SET_INDEXED_VALIDATED:
+			case GDScriptFunction::OPCODE_GET_KEYED_VALIDATED:
+			case GDScriptFunction::OPCODE_GET_INDEXED_VALIDATED:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_INT:
+			case GDScriptFunction::OPCODE_ITERATE_INT:
+				size = 5;
+				break;
+			case GDScriptFunction::OPCODE_SET_NAMED_VALIDATED:
+			case GDScriptFunction::OPCODE_GET_NAMED_VALIDATED:
+			case GDScriptFunction::OPCODE_SET_INDEXED_TYPED_ARRAY:
+			case GDScriptFunction::OPCODE_GET_INDEXED_TYPED_ARRAY:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_BUILTIN:
+				size = 4;
+				break;
+			case GDScriptFunction::OPCODE_ASSIGN:
+			case GDScriptFunction::OPCODE_JUMP_IF:
+			case GDScriptFunction::OPCODE_JUMP_IF_NOT:
+			case GDScriptFunction::OPCODE_RETURN_TYPED_BUILTIN:
+				size = 3;
+				break;
+			case GDScriptFunction::OPCODE_ASSIGN_NULL:
+			case GDScriptFunction::OPCODE_ASSIGN_TRUE:
+			case GDScriptFunction::OPCODE_ASSIGN_FALSE:
+			case GDScriptFunction::OPCODE_JUMP:
+			case GDScriptFunction::OPCODE_RETURN:
+			case GDScriptFunction::OPCODE_LINE:
+				size = 2;
+				break;
+			case GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT:
+			case GDScriptFunction::OPCODE_BREAKPOINT:
+			case GDScriptFunction::OPCODE_END:
+				size = 1;
+				break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_VALIDATED:
+			case GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED:
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN:
+				if (p_ip + 1 < p_code_size && p_code[p_ip + 1] >= 0) {
+					size = p_code[p_ip + 1] + 4;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+
+	if (p_ip + size > p_code_size) {
+		return 0;
+	}
+	return size;
+}
+
+// Offset of the jump destination within the instruction, or 0 if it doesn't jump.
+static int _get_jump_offset(int p_opcode) {
+	switch (p_opcode) {
+		case GDScriptFunction::OPCODE_JUMP:
+			return 1;
+		case GDScriptFunction::OPCODE_JUMP_IF:
+		case GDScriptFunction::OPCODE_JUMP_IF_NOT:
+			return 2;
+		case GDScriptFunction::OPCODE_ITERATE_BEGIN_INT:
+		case GDScriptFunction::OPCODE_ITERATE_INT:
+			return 4;
+		default:
+			return 0;
+	}
+}
+
+void GDScriptAOT::register_function(uint64_t p_hash, int p_code_size, int p_constant_count, GDScriptFunction::AOTFunction p_function) {
+	Function function;
+	function.function = p_function;
+	function.code_size = p_code_size;
+	function.constant_count = p_constant_count;
+	functions[p_hash] = function;
+}
+
+GDScriptFunction::AOTFunction GDScriptAOT::find_function(const GDScriptFunction *p_function) {
+	Vector<int> code;
+	Vector<int> default_arguments;
+	if (!_normalize(p_function, code, default_arguments)) {
+		return nullptr;
+	}
+
+	const Function *function = functions.getptr(_hash(p_function, code, default_arguments));
+	if (!function || function->code_size != code.size() || function->constant_count != p_function->_constant_count) {
+		return nullptr;
+	}
+	return function->function;
+}
+
+void GDScriptAOT::clear() {
+	functions.clear();
+}
+
+// Line and breakpoint markers are dropped and fused instructions split back, so the bytecode of
+// the editor and of a release build compare equal. Jump destinations are relocated to match.
+bool GDScriptAOT::_normalize(const GDScriptFunction *p_function, Vector<int> &r_code, Vector<int> &r_default_arguments) {
+	const int *code = p_function->_code_ptr;
+	const int code_size = p_function->_code_size;
+	if (!code) {
+		return false;
+	}
+
+	Vector<int> positions;
+	positions.resize(code_size + 1);
+	positions.fill(-1);
+	int *position = positions.ptrw();
+
+	int normalized_size = 0;
+	for (int ip = 0; ip < code_size;) {
+		const int size = _get_instruction_size(code, code_size, ip);
+		if (size == 0) {
+			return false;
+		}
+		position[ip] = normalized_size;
+		if (code[ip] != GDScriptFunction::OPCODE_LINE && code[ip] != GDScriptFunction::OPCODE_BREAKPOINT) {
+			normalized_size += size;
+		}
+		ip += size;
+	}
+	position[code_size] = normalized_size;
+
+	r_code.resize(normalized_size);
+	int *normalized = r_code.ptrw();
+	for (int ip = 0; ip < code_size;) {
+		const int size = _get_instruction_size(code, code_size, ip);
+		const int opcode = code[ip];
+		if (opcode == GDScriptFunction::OPCODE_LINE || opcode == GDScriptFunction::OPCODE_BREAKPOINT) {
+			ip += size;
+			continue;
+		}
+
+		int *dst = &normalized[position[ip]];
+		memcpy(dst, &code[ip], sizeof(int) * size);
+
+		if (opcode == GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF || opcode == GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT || opcode == GDScriptFunction::OPCODE_OPERATOR_VALIDATED_ASSIGN) {
+			dst[0] = GDScriptFunction::OPCODE_OPERATOR_VALIDATED;
+		}
+
+		const int jump_offset = _get_jump_offset(opcode);
+		if (jump_offset) {
+			const int to = code[ip + jump_offset];
+			if (to < 0 || to > code_size || position[to] < 0) {
+				return false;
+			}
+			dst[jump_offset] = position[to];
+		}
+
+		ip += size;
+	}
+
+	r_default_arguments.resize(p_function->default_arguments.size());
+	for (int i = 0; i < p_function->default_arguments.size(); i++) {
+		const int to = p_function->default_arguments[i];
+		if (to < 0 || to > code_size || position[to] < 0) {
+			return false;
+		}
+		r_default_arguments.write[i] = position[to];
+	}
+
+	return true;
+}
+
+uint64_t GDScriptAOT::_hash(const GDScriptFunction *p_function, const Vector<int> &p_code, const Vector<int> &p_default_arguments) {
+	uint64_t hash = hash_djb2_one_64(AOT_FORMAT_VERSION);
+	hash = hash_djb2_one_64(p_function->_argument_count, hash);
+	hash = hash_djb2_one_64(p_function->_stack_size, hash);
+	hash = hash_djb2_one_64(p_function->_instruction_args_size, hash);
+
+	// The generated code indexes these tables directly.
+	hash = hash_djb2_one_64(p_function->_constant_count, hash);
+	hash = hash_djb2_one_64(p_function->_global_names_count, hash);
+	hash = hash_djb2_one_64(p_function->_operator_funcs_count, hash);
+	hash = hash_djb2_one_64(p_function->_setters_count, hash);
+	hash = hash_djb2_one_64(p_function->_getters_count, hash);
+	hash = hash_djb2_one_64(p_function->_keyed_setters_count, hash);
+	hash = hash_djb2_one_64(p_function->_keyed_getters_count, hash);
+	hash = hash_djb2_one_64(p_function->_indexed_setters_count, hash);
+	hash = hash_djb2_one_64(p_function->_indexed_getters_count, hash);
+	hash = hash_djb2_one_64(p_function->_builtin_methods_count, hash);
+	hash = hash_djb2_one_64(p_function->_constructors_count, hash);
+	hash = hash_djb2_one_64(p_function->_utilities_count, hash);
+	hash = hash_djb2_one_64(p_function->_methods_count, hash);
+
+	hash = hash_djb2_one_64(p_default_arguments.size(), hash);
+	for (int i = 0; i < p_default_arguments.size(); i++) {
+		hash = hash_djb2_one_64(p_default_arguments[i], hash);
+	}
+
+	hash = hash_djb2_one_64(p_code.size(), hash);
+	for (int i = 0; i < p_code.size(); i++) {
+		hash = hash_djb2_one_64((uint32_t)p_code[i], hash);
+	}
+
+	// Zero means "not translatable".
+	return hash == 0 ? 1 : hash;
+}
+
+uint64_t GDScriptAOT::hash_function(const GDScriptFunction *p_function) {
+	Vector<int> code;
+	Vector<int> default_arguments;
+	if (!_normalize(p_function, code, default_arguments)) {
+		return 0;
+	}
+	return _hash(p_function, code, default_arguments);
+}
+
+String GDScriptAOT::get_function_symbol(uint64_t p_hash) {
+	return "gdscript_aot_" + String::num_uint64(p_hash, 16);
+}
+
+Error GDScriptAOT::translate_function(const GDScriptFunction *p_function, Translation &r_translation, uint64_t *r_hash) {
+	Vector<int> normalized;
+	Vector<int> default_arguments;
+	if (!_normalize(p_function, normalized, default_arguments)) {
+		return ERR_UNAVAILABLE;
+	}
+	const uint64_t hash = _hash(p_function, normalized, default_arguments);
+
+	const int *code = normalized.ptr();
+	const int code_size = normalized.size();
+
+	// Only jump destinations get a label, others would be unused.
+	HashSet<int> labels;
+	for (int ip = 0; ip < code_size;) {
+		const int opcode = code[ip];
+		const int jump_offset = _get_jump_offset(opcode);
+		if (jump_offset) {
+			labels.insert(code[ip + jump_offset]);
+		} else if (opcode == GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT) {
+			for (int i = 0; i < default_arguments.size(); i++) {
+				labels.insert(default_arguments[i]);
+			}
+		}
+		ip += _get_instruction_size(code, code_size, ip);
+	}
+
+	bool uses_stack = false;
+	bool uses_constants = false;
+	bool uses_members = false;
+	bool valid = true;
+
+	auto address = [&](int p_address) -> String {
+		const int index = p_address & GDScriptFunction::ADDR_MASK;
+		switch ((p_address & GDScriptFunction::ADDR_TYPE_MASK) >> GDScriptFunction::ADDR_BITS) {
+			case GDScriptFunction::ADDR_TYPE_STACK:
+				if (index >= p_function->_stack_size) {
+					break;
+				}
+				uses_stack = true;
+				return "&stack[" + itos(index) + "]";
+			case GDScriptFunction::ADDR_TYPE_CONSTANT:
+				if (index >= p_function->_constant_count) {
+					break;
+				}
+				uses_constants = true;
+				return "&constants[" + itos(index) + "]";
+			case GDScriptFunction::ADDR_TYPE_MEMBER:
+				uses_members = true;
+				return "&members[" + itos(index) + "]";
+		}
+		valid = false;
+		return String();
+	};
+
+	auto label = [](int p_position) -> String {
+		return "l" + itos(p_position);
+	};
+
+	String body;
+	for (int ip = 0; ip < code_size && valid;) {
+		const int opcode = code[ip];
+		const int size = _get_instruction_size(code, code_size, ip);
+
+		if (labels.has(ip)) {
+			body += label(ip) + ":\n";
+		}
+
+		// Same as `GET_VARIANT_PTR()` in the VM.
+#define ADDR(m_code_ofs) address(code[ip + 1 + (m_code_ofs)])
+
+		if (opcode >= GDScriptFunction::OPCODE_TYPE_ADJUST_BOOL && opcode <= GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY) {
+			body += vformat("\tVariantTypeAdjust<%s>::adjust(%s);\n", type_adjust_types[opcode - GDScriptFunction::OPCODE_TYPE_ADJUST_BOOL], ADDR(0));
+			ip += size;
+			continue;
+		}
+
+		switch (opcode) {
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED: {
+				body += vformat("\tp_frame.operator_funcs[%d](%s, %s, %s);\n", code[ip + 4], ADDR(0), ADDR(1), ADDR(2));
+			} break;
+			case GDScriptFunction::OPCODE_SET_NAMED_VALIDATED: {
+				body += vformat("\tp_frame.setters[%d](%s, %s);\n", code[ip + 3], ADDR(0), ADDR(1));
+			} break;
+			case GDScriptFunction::OPCODE_GET_NAMED_VALIDATED: {
+				body += vformat("\tp_frame.getters[%d](%s, %s);\n", code[ip + 3], ADDR(0), ADDR(1));
+			} break;
+			case GDScriptFunction::OPCODE_SET_KEYED_VALIDATED: {
+				body += "\t{\n\t\tbool valid;\n";
+				body += vformat("\t\tp_frame.keyed_setters[%d](%s, %s, %s, &valid);\n", code[ip + 4], ADDR(0), ADDR(1), ADDR(2));
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_SET_INDEXED_VALIDATED: {
+				body += "\t{\n\t\tbool oob;\n";
+				body += vformat("\t\tp_frame.indexed_setters[%d](%s, *VariantInternal::get_int(%s), %s, &oob);\n", code[ip + 4], ADDR(0), ADDR(1), ADDR(2));
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_GET_KEYED_VALIDATED: {
+				body += "\t{\n\t\tbool valid;\n";
+				body += vformat("\t\tp_frame.keyed_getters[%d](%s, %s, %s, &valid);\n", code[ip + 4], ADDR(0), ADDR(1), ADDR(2));
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_GET_INDEXED_VALIDATED: {
+				body += "\t{\n\t\tbool oob;\n";
+				body += vformat("\t\tp_frame.indexed_getters[%d](%s, *VariantInternal::get_int(%s), %s, &oob);\n", code[ip + 4], ADDR(0), ADDR(1), ADDR(2));
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_SET_INDEXED_TYPED_ARRAY: {
+				body += vformat("\t{\n\t\tArray *array = VariantInternal::get_array(%s);\n", ADDR(0));
+				body += vformat("\t\tint64_t index = *VariantInternal::get_int(%s);\n", ADDR(1));
+				body += "\t\tif (index < 0) {\n\t\t\tindex += array->size();\n\t\t}\n";
+				body += vformat("\t\tif (index >= 0 && index < array->size() && !array->is_read_only()) {\n\t\t\t(*array)[index] = *%s;\n\t\t}\n", ADDR(2));
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_GET_INDEXED_TYPED_ARRAY: {
+				body += vformat("\t{\n\t\tconst Array *array = VariantInternal::get_array((const Variant *)%s);\n", ADDR(0));
+				body += vformat("\t\tint64_t index = *VariantInternal::get_int(%s);\n", ADDR(1));
+				body += "\t\tif (index < 0) {\n\t\t\tindex += array->size();\n\t\t}\n";
+				body += vformat("\t\tif (index >= 0 && index < array->size()) {\n\t\t\t*%s = (*array)[index];\n\t\t}\n", ADDR(2));
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN: {
+				body += vformat("\t*%s = *%s;\n", ADDR(0), ADDR(1));
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN_NULL: {
+				body += vformat("\t*%s = Variant();\n", ADDR(0));
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN_TRUE: {
+				body += vformat("\t*%s = true;\n", ADDR(0));
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN_FALSE: {
+				body += vformat("\t*%s = false;\n", ADDR(0));
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_BUILTIN: {
+				const int type = code[ip + 3];
+				if (type < 0 || type >= Variant::VARIANT_MAX) {
+					valid = false;
+					break;
+				}
+				const String dst = ADDR(0);
+				const String src = ADDR(1);
+				body += vformat("\tif ((%s)->get_type() != Variant::Type(%d)) {\n", src, type);
+				body += vformat("\t\tconst Variant *arg = %s;\n", src);
+				body += "\t\tCallable::CallError ce;\n";
+				body += vformat("\t\tVariant::construct(Variant::Type(%d), *%s, &arg, 1, ce);\n", type, dst);
+				body += "\t} else {\n";
+				body += vformat("\t\t*%s = *%s;\n", dst, src);
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_VALIDATED:
+			case GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED:
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN: {
+				// Layout: opcode, address count, addresses..., argument count, table index.
+				const int instr_arg_count = code[ip + 1];
+				const int argc = code[ip + 2 + instr_arg_count];
+				const int index = code[ip + 3 + instr_arg_count];
+				const bool has_base = opcode != GDScriptFunction::OPCODE_CONSTRUCT_VALIDATED && opcode != GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED;
+				if (argc < 0 || instr_arg_count != argc + (has_base ? 2 : 1)) {
+					valid = false;
+					break;
+				}
+
+				Vector<String> args;
+				for (int i = 0; i < instr_arg_count; i++) {
+					args.push_back(address(code[ip + 2 + i]));
+				}
+
+				body += "\t{\n";
+				String args_ptr = "nullptr";
+				if (argc > 0) {
+					body += "\t\tconst Variant *args[] = { " + String(", ").join(args.slice(0, argc)) + " };\n";
+					args_ptr = "args";
+				}
+
+				switch (opcode) {
+					case GDScriptFunction::OPCODE_CONSTRUCT_VALIDATED: {
+						body += vformat("\t\tp_frame.constructors[%d](%s, %s);\n", index, args[argc], args_ptr);
+					} break;
+					case GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED: {
+						body += vformat("\t\tp_frame.utilities[%d](%s, %s, %d);\n", index, args[argc], args_ptr, argc);
+					} break;
+					case GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED: {
+						body += vformat("\t\tp_frame.builtin_methods[%d](%s, %s, %d, %s);\n", index, args[argc], args_ptr, argc, args[argc + 1]);
+					} break;
+					case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN: {
+						body += vformat("\t\tp_frame.methods[%d]->validated_call(*VariantInternal::get_object(%s), %s, %s);\n", index, args[argc], args_ptr, args[argc + 1]);
+					} break;
+					case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN: {
+						body += vformat("\t\tVariantInternal::initialize(%s, Variant::NIL);\n", args[argc + 1]);
+						body += vformat("\t\tp_frame.methods[%d]->validated_call(*VariantInternal::get_object(%s), %s, nullptr);\n", index, args[argc], args_ptr);
+					} break;
+				}
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_JUMP: {
+				body += vformat("\tgoto %s;\n", label(code[ip + 1]));
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_IF: {
+				body += vformat("\tif ((%s)->booleanize()) {\n\t\tgoto %s;\n\t}\n", ADDR(0), label(code[ip + 2]));
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_IF_NOT: {
+				body += vformat("\tif (!(%s)->booleanize()) {\n\t\tgoto %s;\n\t}\n", ADDR(0), label(code[ip + 2]));
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT: {
+				body += "\tswitch (p_frame.default_argument) {\n";
+				for (int i = 0; i < default_arguments.size(); i++) {
+					body += vformat("\t\tcase %d:\n\t\t\tgoto %s;\n", i, label(default_arguments[i]));
+				}
+				body += "\t\tdefault:\n\t\t\treturn;\n\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_RETURN: {
+				body += vformat("\t*p_frame.result = *%s;\n\treturn;\n", ADDR(0));
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_BUILTIN: {
+				const int type = code[ip + 2];
+				if (type < 0 || type >= Variant::VARIANT_MAX) {
+					valid = false;
+					break;
+				}
+				const String r = ADDR(0);
+				body += "\t{\n";
+				body += vformat("\t\tconst Variant *r = %s;\n", r);
+				body += "\t\tCallable::CallError ce;\n";
+				body += vformat("\t\tif (r->get_type() == Variant::Type(%d)) {\n", type);
+				body += "\t\t\t*p_frame.result = *r;\n";
+				body += vformat("\t\t} else if (Variant::can_convert_strict(r->get_type(), Variant::Type(%d))) {\n", type);
+				body += vformat("\t\t\tVariant::construct(Variant::Type(%d), *p_frame.result, &r, 1, ce);\n", type);
+				body += "\t\t} else {\n";
+				body += vformat("\t\t\tVariant::construct(Variant::Type(%d), *p_frame.result, nullptr, 0, ce);\n", type);
+				body += "\t\t}\n";
+				body += "\t\treturn;\n";
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_INT: {
+				const String counter = ADDR(0);
+				const String container = ADDR(1);
+				const String iterator = ADDR(2);
+				body += "\t{\n";
+				body += vformat("\t\tconst int64_t size = *VariantInternal::get_int(%s);\n", container);
+				body += vformat("\t\tVariantInternal::initialize(%s, Variant::INT);\n", counter);
+				body += vformat("\t\t*VariantInternal::get_int(%s) = 0;\n", counter);
+				body += vformat("\t\tif (size <= 0) {\n\t\t\tgoto %s;\n\t\t}\n", label(code[ip + 4]));
+				body += vformat("\t\tVariantInternal::initialize(%s, Variant::INT);\n", iterator);
+				body += vformat("\t\t*VariantInternal::get_int(%s) = 0;\n", iterator);
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_ITERATE_INT: {
+				const String counter = ADDR(0);
+				const String container = ADDR(1);
+				const String iterator = ADDR(2);
+				body += vformat("\tif (++*VariantInternal::get_int(%s) >= *VariantInternal::get_int(%s)) {\n\t\tgoto %s;\n\t}\n", counter, container, label(code[ip + 4]));
+				body += vformat("\t*VariantInternal::get_int(%s) = *VariantInternal::get_int(%s);\n", iterator, counter);
+			} break;
+			case GDScriptFunction::OPCODE_END: {
+				body += "\treturn;\n";
+			} break;
+			default: {
+				valid = false;
+			} break;
+		}
+
+#undef ADDR
+
+		ip += size;
+	}
+
+	if (!valid) {
+		return ERR_UNAVAILABLE;
+	}
+
+	if (labels.has(code_size)) {
+		body += label(code_size) + ":\n\treturn;\n";
+	}
+
+	String &text = r_translation.code;
+	text = "// " + String(p_function->get_source()) + "::" + String(p_function->get_name()) + "\n";
+	text += "static void " + get_function_symbol(hash) + "(GDScriptFunction::AOTFrame &p_frame) {\n";
+	if (uses_stack) {
+		text += "\tVariant *stack = p_frame.stack;\n";
+	}
+	if (uses_constants) {
+		text += "\tVariant *constants = p_frame.constants;\n";
+	}
+	if (uses_members) {
+		text += "\tVariant *members = p_frame.members;\n";
+	}
+	if (uses_stack || uses_constants || uses_members) {
+		text += "\n";
+	}
+	text += body;
+	text += "}\n";
+	r_translation.code_size = code_size;
+	r_translation.constant_count = p_function->_constant_count;
+
+	if (r_hash) {
+		*r_hash = hash;
+	}
+	return OK;
+}
+
+void GDScriptAOT::translate_script(const GDScript *p_script, HashMap<uint64_t, Translation> &r_functions) {
+	List<const GDScriptFunction *> pending;
+	for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->get_member_functions()) {
+		pending.push_back(E.value);
+	}
+	if (p_script->implicit_initializer) {
+		pending.push_back(p_script->implicit_initializer);
+	}
+	if (p_script->implicit_ready) {
+		pending.push_back(p_script->implicit_ready);
+	}
+
+	while (!pending.is_empty()) {
+		const GDScriptFunction *function = pending.front()->get();
+		pending.pop_front();
+
+		for (int i = 0; i < function->_lambdas_count; i++) {
+			pending.push_back(function->_lambdas_ptr[i]);
+		}
+
+		Translation translation;
+		uint64_t hash = 0;
+		if (translate_function(function, translation, &hash) == OK && !r_functions.has(hash)) {
+			r_functions.insert(hash, translation);
+		}
+	}
+
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->get_subclasses()) {
+		translate_script(E.value.ptr(), r_functions);
+	}
+}
+
+String GDScriptAOT::generate_source(const HashMap<uint64_t, Translation> &p_functions) {
+	String source = "// Generated by the GDScript export plugin, do not edit.\n";
+	source += "// Build it into the export template with `gdscript_aot_source=<path to this file>`.\n\n";
+	source += "#include \"modules/gdscript/gdscript_aot.h\"\n\n";
+	source += "#include \"core/object/method_bind.h\"\n";
+	source += "#include \"core/variant/variant_internal.h\"\n";
+
+	for (const KeyValue<uint64_t, Translation> &E : p_functions) {
+		source += "\n" + E.value.code;
+	}
+
+	source += "\nvoid register_gdscript_aot_functions() {\n";
+	for (const KeyValue<uint64_t, Translation> &E : p_functions) {
+		source += vformat("\tGDScriptAOT::register_function(%sULL, %d, %d, &%s);\n", "0x" + String::num_uint64(E.key, 16), E.value.code_size, E.value.constant_count, get_function_symbol(E.key));
+	}
+	source += "}\n";
+
+	return source;
+}
@@ -0,0 +1,92 @@
+/**************************************************************************/
+/*  gdscript_aot.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef GDSCRIPT_AOT_H
+#define GDSCRIPT_AOT_H
+
+#include "gdscript_function.h"
+
+#include "core/templates/hash_map.h"
+
+class GDScript;
+
+// Translates compiled GDScript functions to C++ so they can be built into an export template.
+//
+// Only functions made entirely of validated (fully typed) instructions are translated. The
+// generated code mirrors the release VM one instruction at a time, but reads operators, methods
+// and constructors from the tables of the function it replaces, so it stays correct as long as the
+// bytecode matches. Translated functions are identified by a hash of their normalized bytecode,
+// which is computed again when the same script is compiled at runtime. The code size and constant
+// count are compared as well, so a hash collision can't run code built for another function;
+// anything that doesn't match runs in the VM as usual.
+class GDScriptAOT {
+public:
+	struct Translation {
+		String code;
+		int code_size = 0;
+		int constant_count = 0;
+	};
+
+private:
+	struct Function {
+		GDScriptFunction::AOTFunction function = nullptr;
+		int code_size = 0;
+		int constant_count = 0;
+	};
+
+	static HashMap<uint64_t, Function> functions;
+
+	static bool _normalize(const GDScriptFunction *p_function, Vector<int> &r_code, Vector<int> &r_default_arguments);
+	static uint64_t _hash(const GDScriptFunction *p_function, const Vector<int> &p_code, const Vector<int> &p_default_arguments);
+
+public:
+	static void register_function(uint64_t p_hash, int p_code_size, int p_constant_count, GDScriptFunction::AOTFunction p_function);
+	// Returns the translation built from the same bytecode, if any.
+	static GDScriptFunction::AOTFunction find_function(const GDScriptFunction *p_function);
+	static bool has_functions() { return !functions.is_empty(); }
+	static void clear();
+
+	// Returns 0 if the function can't be translated.
+	static uint64_t hash_function(const GDScriptFunction *p_function);
+	static Error translate_function(const GDScriptFunction *p_function, Translation &r_translation, uint64_t *r_hash = nullptr);
+
+	// Translates every function of the script, its lambdas and its inner classes, keyed by hash.
+	static void translate_script(const GDScript *p_script, HashMap<uint64_t, Translation> &r_functions);
+	static String generate_source(const HashMap<uint64_t, Translation> &p_functions);
+	static String get_function_symbol(uint64_t p_hash);
+};
+
+#ifdef GDSCRIPT_AOT_ENABLED
+// Defined by the generated source.
+void register_gdscript_aot_functions();
+#endif
+
+#endif // GDSCRIPT_AOT_H
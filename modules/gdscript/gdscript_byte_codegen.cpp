@@ -31,9 +31,12 @@
 #include "gdscript_byte_codegen.h"
 
 #include "gdscript.h"
+#include "gdscript_aot.h"
 
 #include "core/debugger/engine_debugger.h"
 
+bool GDScriptByteCodeGenerator::superinstructions_enabled = true;
+
 uint32_t GDScriptByteCodeGenerator::add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) {
 	function->_argument_count++;
 	function->argument_types.push_back(p_type);
@@ -150,7 +153,7 @@ void GDScriptByteCodeGenerator::pop_temporary() {
 
 void GDScriptByteCodeGenerator::start_parameters() {
 	if (function->_default_arg_count > 0) {
-		append(GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT);
+		append_opcode(GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT);
 		function->default_arguments.push_back(opcodes.size());
 	}
 }
@@ -196,6 +199,10 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		}
 	}
 
+	if (superinstructions_enabled) {
+		fuse_superinstructions();
+	}
+
 	if (constant_map.size()) {
 		function->_constant_count = constant_map.size();
 		function->constants.resize(constant_map.size());
@@ -383,6 +390,14 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_methods_count = 0;
 	}
 
+	if (inline_cache_count) {
+		function->_inline_caches_ptr = memnew_arr(GDScriptFunction::InlineCache, inline_cache_count);
+		function->_inline_caches_count = inline_cache_count;
+	} else {
+		function->_inline_caches_ptr = nullptr;
+		function->_inline_caches_count = 0;
+	}
+
 	if (lambdas_map.size()) {
 		function->lambdas.resize(lambdas_map.size());
 		function->_lambdas_ptr = function->lambdas.ptrw();
@@ -401,6 +416,10 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 	function->_stack_size = GDScriptFunction::FIXED_ADDRESSES_MAX + max_locals + temporaries.size();
 	function->_instruction_args_size = instr_args_max;
 
+	if (GDScriptAOT::has_functions()) {
+		function->_aot_function = GDScriptAOT::find_function(function);
+	}
+
 #ifdef DEBUG_ENABLED
 	function->operator_names = operator_names;
 	function->setter_names = setter_names;
@@ -415,6 +434,48 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 	return function;
 }
 
+void GDScriptByteCodeGenerator::fuse_superinstructions() {
+	// Only the opcode of the first instruction of a pair is replaced. Its operands and the second
+	// instruction are left as they are, so code jumping straight to the second one still works
+	// and no jump needs to be relocated.
+	int *code = opcodes.ptrw();
+	for (int i = 0; i + 1 < instruction_starts.size(); i++) {
+		const int first = instruction_starts[i];
+		const int second = instruction_starts[i + 1];
+
+		switch (code[first]) {
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED: {
+				const int result = code[first + 3];
+				if (code[second] == GDScriptFunction::OPCODE_JUMP_IF && code[second + 1] == result) {
+					code[first] = GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF;
+				} else if (code[second] == GDScriptFunction::OPCODE_JUMP_IF_NOT && code[second + 1] == result) {
+					code[first] = GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT;
+				} else if (code[second] == GDScriptFunction::OPCODE_ASSIGN && code[second + 2] == result) {
+					code[first] = GDScriptFunction::OPCODE_OPERATOR_VALIDATED_ASSIGN;
+				}
+			} break;
+			case GDScriptFunction::OPCODE_GET_MEMBER: {
+				if (code[second] != GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN && code[second] != GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN) {
+					break;
+				}
+				// The call base comes right after the arguments.
+				const int instr_arg_count = code[second + 1];
+				const int argc = code[second + 2 + instr_arg_count];
+				if (code[second + 2 + argc] != code[first + 1]) {
+					break;
+				}
+				if (code[second] == GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN) {
+					code[first] = GDScriptFunction::OPCODE_GET_MEMBER_CALL_METHOD_BIND_VALIDATED_RETURN;
+				} else {
+					code[first] = GDScriptFunction::OPCODE_GET_MEMBER_CALL_METHOD_BIND_VALIDATED_NO_RETURN;
+				}
+			} break;
+			default:
+				break;
+		}
+	}
+}
+
 #ifdef DEBUG_ENABLED
 void GDScriptByteCodeGenerator::set_signature(const String &p_signature) {
 	function->profile.signature = p_signature;
@@ -771,8 +832,25 @@ void GDScriptByteCodeGenerator::write_end_ternary() {
 	ternary_result.pop_back();
 }
 
+static bool _is_builtin_typed_array(const GDScriptDataType &p_type) {
+	if (p_type.builtin_type != Variant::ARRAY || !p_type.has_container_element_type(0)) {
+		return false;
+	}
+	const GDScriptDataType &element_type = p_type.get_container_element_type(0);
+	return element_type.has_type && element_type.kind == GDScriptDataType::BUILTIN && element_type.builtin_type != Variant::NIL && element_type.builtin_type != Variant::OBJECT;
+}
+
 void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address &p_index, const Address &p_source) {
 	if (HAS_BUILTIN_TYPE(p_target)) {
+		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && _is_builtin_typed_array(p_target.type) &&
+				IS_BUILTIN_TYPE(p_source, p_target.type.get_container_element_type(0).builtin_type)) {
+			// The source already has the element type, so the array doesn't need to validate it.
+			append_opcode(GDScriptFunction::OPCODE_SET_INDEXED_TYPED_ARRAY);
+			append(p_target);
+			append(p_index);
+			append(p_source);
+			return;
+		}
 		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_setter(p_target.type.builtin_type) &&
 				IS_BUILTIN_TYPE(p_source, Variant::get_indexed_element_type(p_target.type.builtin_type))) {
 			// Use indexed setter instead.
@@ -802,6 +880,13 @@ void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address
 
 void GDScriptByteCodeGenerator::write_get(const Address &p_target, const Address &p_index, const Address &p_source) {
 	if (HAS_BUILTIN_TYPE(p_source)) {
+		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && _is_builtin_typed_array(p_source.type)) {
+			append_opcode(GDScriptFunction::OPCODE_GET_INDEXED_TYPED_ARRAY);
+			append(p_source);
+			append(p_index);
+			append(p_target);
+			return;
+		}
 		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_getter(p_source.type.builtin_type)) {
 			// Use indexed getter instead.
 			Variant::ValidatedIndexedGetter getter = Variant::get_member_validated_indexed_getter(p_source.type.builtin_type);
@@ -844,6 +929,7 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -862,6 +948,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -977,7 +1064,8 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 		append(p_target);
 		append(p_source);
 		append(p_target.type.builtin_type);
-	} else {
+	} else if (p_target.mode != p_source.mode || p_target.address != p_source.address) {
+		// Assigning something to itself does nothing, skip it.
 		append_opcode(GDScriptFunction::OPCODE_ASSIGN);
 		append(p_target);
 		append(p_source);
@@ -1076,6 +1164,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1101,6 +1190,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1335,6 +1425,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1348,6 +1439,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1361,6 +1453,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -75,15 +75,17 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 				// It's ok if its the first thing done here.
 				get_parser()->clear();
 				status = PARSED;
-				String remapped_path = ResourceLoader::path_remap(path);
-				if (remapped_path.get_extension().to_lower() == "gdc") {
-					Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
-					source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
-					result = get_parser()->parse_binary(tokens, path);
+				GDScriptParser *prefetched = GDScriptCache::_take_prefetched_parser(path, source_hash, result);
+				if (prefetched) {
+					if (parser) {
+						memdelete(parser);
+					}
+					parser = prefetched;
 				} else {
-					String source = GDScriptCache::get_source_code(remapped_path);
-					source_hash = source.hash();
-					result = get_parser()->parse(source, path, false);
+					result = GDScriptCache::_parse_script(get_parser(), path, source_hash);
+				}
+				if (result == OK) {
+					GDScriptCache::_prefetch_dependencies(this);
 				}
 			} break;
 			case PARSED: {
@@ -121,6 +123,7 @@ void GDScriptParserRef::clear() {
 	status = EMPTY;
 	result = OK;
 	source_hash = 0;
+	dependencies_prefetched = false;
 
 	clearing = false;
 
@@ -198,6 +201,12 @@ void GDScriptCache::remove_script(const String &p_path) {
 
 	singleton->abandoned_parser_map.erase(p_path);
 
+	if (HashMap<String, PrefetchedParser *>::Iterator E = singleton->prefetched_parsers.find(p_path)) {
+		// Parsed from a version of the file that may be outdated now.
+		singleton->stale_prefetched_parsers.push_back(E->value);
+		singleton->prefetched_parsers.remove(E);
+	}
+
 	if (singleton->parser_map.has(p_path)) {
 		singleton->parser_map[p_path]->clear();
 	}
@@ -295,6 +304,120 @@ Vector<uint8_t> GDScriptCache::get_binary_tokens(const String &p_path) {
 	return buffer;
 }
 
+Error GDScriptCache::_parse_script(GDScriptParser *p_parser, const String &p_path, uint32_t &r_source_hash) {
+	const String remapped_path = ResourceLoader::path_remap(p_path);
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		Vector<uint8_t> tokens = get_binary_tokens(remapped_path);
+		r_source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
+		return p_parser->parse_binary(tokens, p_path);
+	}
+
+	const String source = get_source_code(remapped_path);
+	r_source_hash = source.hash();
+
+	return p_parser->parse(source, p_path, false);
+}
+
+void GDScriptCache::_prefetch_parse(void *p_userdata) {
+	PrefetchedParser *prefetched = static_cast<PrefetchedParser *>(p_userdata);
+	prefetched->result = _parse_script(prefetched->parser, prefetched->path, prefetched->source_hash);
+}
+
+void GDScriptCache::_prefetch_dependencies(GDScriptParserRef *p_parser_ref) {
+	// Only worth it while resources are loading, the analyzer is about to need these scripts.
+	if (p_parser_ref->dependencies_prefetched || !ResourceLoader::is_within_load()) {
+		return;
+	}
+
+	MutexLock lock(singleton->mutex);
+	if (singleton->cleared) {
+		return;
+	}
+	p_parser_ref->dependencies_prefetched = true;
+
+	_free_prefetched_parsers(false);
+
+	const GDScriptParser *parser = p_parser_ref->get_parser();
+	HashSet<String> paths;
+	for (const String &E : parser->get_prefetch_paths()) {
+		// Resolved the same way as the analyzer does.
+		const String path = E.is_relative_path() ? p_parser_ref->path.get_base_dir().path_join(E).simplify_path() : E;
+		paths.insert(path);
+	}
+	for (const StringName &E : parser->get_prefetch_class_names()) {
+		if (ScriptServer::is_global_class(E)) {
+			paths.insert(ScriptServer::get_global_class_path(E));
+		}
+	}
+
+	// Static tables the parser fills on first use must not be filled from several threads at once.
+	GDScriptParser::get_builtin_type(StringName());
+
+	for (const String &path : paths) {
+		if (path.get_extension().to_lower() != "gd" || path == p_parser_ref->path) {
+			continue;
+		}
+		if (singleton->parser_map.has(path) || singleton->prefetched_parsers.has(path) || singleton->full_gdscript_cache.has(path)) {
+			continue;
+		}
+		if (!FileAccess::exists(ResourceLoader::path_remap(path))) {
+			continue;
+		}
+
+		PrefetchedParser *prefetched = memnew(PrefetchedParser);
+		prefetched->path = path;
+		prefetched->parser = memnew(GDScriptParser);
+		prefetched->task_id = WorkerThreadPool::get_singleton()->add_native_task(&GDScriptCache::_prefetch_parse, prefetched, false, "Parse GDScript " + path);
+		singleton->prefetched_parsers.insert(path, prefetched);
+	}
+}
+
+GDScriptParser *GDScriptCache::_take_prefetched_parser(const String &p_path, uint32_t &r_source_hash, Error &r_result) {
+	MutexLock lock(singleton->mutex);
+
+	HashMap<String, PrefetchedParser *>::Iterator E = singleton->prefetched_parsers.find(p_path);
+	if (!E) {
+		return nullptr;
+	}
+	PrefetchedParser *prefetched = E->value;
+	singleton->prefetched_parsers.remove(E);
+
+	Error err = OK;
+	if (WorkerThreadPool::get_singleton()->is_task_completed(prefetched->task_id)) {
+		err = WorkerThreadPool::get_singleton()->wait_for_task_completion(prefetched->task_id);
+	} else {
+		uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(singleton->mutex);
+		err = WorkerThreadPool::get_singleton()->wait_for_task_completion(prefetched->task_id);
+		WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
+	}
+
+	if (err != OK) {
+		// Can't wait on an older task from here (`ERR_BUSY`), parse it again instead.
+		singleton->stale_prefetched_parsers.push_back(prefetched);
+		return nullptr;
+	}
+
+	GDScriptParser *parser = prefetched->parser;
+	r_source_hash = prefetched->source_hash;
+	r_result = prefetched->result;
+	memdelete(prefetched);
+	return parser;
+}
+
+void GDScriptCache::_free_prefetched_parsers(bool p_wait) {
+	for (uint32_t i = 0; i < singleton->stale_prefetched_parsers.size();) {
+		PrefetchedParser *prefetched = singleton->stale_prefetched_parsers[i];
+		if (!p_wait && !WorkerThreadPool::get_singleton()->is_task_completed(prefetched->task_id)) {
+			i++;
+			continue;
+		}
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(prefetched->task_id);
+		memdelete(prefetched->parser);
+		memdelete(prefetched);
+		singleton->stale_prefetched_parsers.remove_at_unordered(i);
+	}
+}
+
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_error, const String &p_owner) {
 	MutexLock lock(singleton->mutex);
 
@@ -470,6 +593,12 @@ void GDScriptCache::clear() {
 
 	singleton->abandoned_parser_map.clear();
 
+	for (const KeyValue<String, PrefetchedParser *> &E : singleton->prefetched_parsers) {
+		singleton->stale_prefetched_parsers.push_back(E.value);
+	}
+	singleton->prefetched_parsers.clear();
+	_free_prefetched_parsers(true);
+
 	RBSet<Ref<GDScriptParserRef>> parser_map_refs;
 	for (KeyValue<String, GDScriptParserRef *> &E : singleton->parser_map) {
 		parser_map_refs.insert(E.value);
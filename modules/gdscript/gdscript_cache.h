@@ -34,9 +34,11 @@
 #include "gdscript.h"
 
 #include "core/object/ref_counted.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/safe_binary_mutex.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 
 class GDScriptAnalyzer;
 class GDScriptParser;
@@ -60,6 +62,7 @@ private:
 	uint32_t source_hash = 0;
 	bool clearing = false;
 	bool abandoned = false;
+	bool dependencies_prefetched = false;
 
 	friend class GDScriptCache;
 	friend class GDScript;
@@ -87,6 +90,18 @@ class GDScriptCache {
 	HashMap<String, HashSet<String>> dependencies;
 	HashMap<String, HashSet<String>> parser_inverse_dependencies;
 
+	// Scripts parsed on the `WorkerThreadPool` while a dependent script is being loaded. Adopted by
+	// the `GDScriptParserRef` of the same path when it first needs parsing.
+	struct PrefetchedParser {
+		String path;
+		GDScriptParser *parser = nullptr;
+		uint32_t source_hash = 0;
+		Error result = OK;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	};
+	HashMap<String, PrefetchedParser *> prefetched_parsers;
+	LocalVector<PrefetchedParser *> stale_prefetched_parsers; // Not adopted, still have to be waited for.
+
 	friend class GDScript;
 	friend class GDScriptParserRef;
 	friend class GDScriptInstance;
@@ -102,6 +117,12 @@ private:
 	static SafeBinaryMutex<BINARY_MUTEX_TAG> mutex;
 	friend SafeBinaryMutex<BINARY_MUTEX_TAG> &_get_gdscript_cache_mutex();
 
+	static Error _parse_script(GDScriptParser *p_parser, const String &p_path, uint32_t &r_source_hash);
+	static void _prefetch_parse(void *p_userdata);
+	static void _prefetch_dependencies(GDScriptParserRef *p_parser_ref);
+	static GDScriptParser *_take_prefetched_parser(const String &p_path, uint32_t &r_source_hash, Error &r_result);
+	static void _free_prefetched_parsers(bool p_wait);
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
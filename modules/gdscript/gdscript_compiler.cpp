@@ -2646,6 +2646,9 @@ Error GDScriptCompiler::_prepare_compilation(GDScript *p_script, const GDScriptP
 
 	parsing_classes.insert(p_script);
 
+	// Member indices and methods may change, drop the resolutions the VM cached against this script.
+	p_script->inline_cache_epoch.set(GDScriptFunction::inline_cache_epoch.increment());
+
 	p_script->clearing = true;
 
 	p_script->native = Ref<GDScriptNativeClass>();
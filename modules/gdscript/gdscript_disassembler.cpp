@@ -100,6 +100,8 @@ static String _disassemble_address(const GDScript *p_script, const GDScriptFunct
 void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 #define DADDR(m_ip) (_disassemble_address(_script, *this, _code_ptr[ip + m_ip]))
 
+	int superinstruction_count = 0;
+
 	for (int ip = 0; ip < _code_size;) {
 		StringBuilder text;
 		int incr = 0;
@@ -267,6 +269,16 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+			case OPCODE_SET_INDEXED_TYPED_ARRAY: {
+				text += "set indexed typed array ";
+				text += DADDR(1);
+				text += "[";
+				text += DADDR(2);
+				text += "] = ";
+				text += DADDR(3);
+
+				incr += 4;
+			} break;
 			case OPCODE_GET_KEYED: {
 				text += "get keyed ";
 				text += DADDR(3);
@@ -300,6 +312,17 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+			case OPCODE_GET_INDEXED_TYPED_ARRAY: {
+				text += "get indexed typed array ";
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += "[";
+				text += DADDR(2);
+				text += "]";
+
+				incr += 4;
+			} break;
 			case OPCODE_SET_NAMED: {
 				text += "set_named ";
 				text += DADDR(1);
@@ -308,7 +331,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "\"] = ";
 				text += DADDR(2);
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_SET_NAMED_VALIDATED: {
 				text += "set_named validated ";
@@ -329,7 +352,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -698,7 +721,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				incr = 6 + argc;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
@@ -1262,6 +1285,36 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				DISASSEMBLE_TYPE_ADJUST(PACKED_COLOR_ARRAY);
 				DISASSEMBLE_TYPE_ADJUST(PACKED_VECTOR4_ARRAY);
 
+			// Superinstructions run the next instruction too, which is printed on its own line.
+			case OPCODE_OPERATOR_VALIDATED_JUMP_IF:
+			case OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT:
+			case OPCODE_OPERATOR_VALIDATED_ASSIGN: {
+				text += "fused validated operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += operator_names[_code_ptr[ip + 4]];
+				text += " ";
+				text += DADDR(2);
+
+				superinstruction_count++;
+				incr += 5;
+			} break;
+			case OPCODE_GET_MEMBER_CALL_METHOD_BIND_VALIDATED_RETURN:
+			case OPCODE_GET_MEMBER_CALL_METHOD_BIND_VALIDATED_NO_RETURN: {
+				text += "fused get_member ";
+				text += DADDR(1);
+				text += " = ";
+				text += "[\"";
+				text += _global_names_ptr[_code_ptr[ip + 2]];
+				text += "\"]";
+
+				superinstruction_count++;
+				incr += 3;
+			} break;
+
 			case OPCODE_ASSERT: {
 				text += "assert (";
 				text += DADDR(1);
@@ -1288,6 +1341,10 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 			print_line(text.as_string());
 		}
 	}
+
+	if (superinstruction_count > 0) {
+		print_line(vformat(" %d instruction pairs fused into superinstructions.", superinstruction_count));
+	}
 }
 
 #endif // DEBUG_ENABLED
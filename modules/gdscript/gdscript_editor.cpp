@@ -287,7 +287,7 @@ int GDScriptLanguage::debug_get_stack_level_count() const {
 		return 1;
 	}
 
-	return _call_stack.stack_pos;
+	return _call_stack.stack_pos.load(std::memory_order_relaxed);
 }
 
 int GDScriptLanguage::debug_get_stack_level_line(int p_level) const {
@@ -295,9 +295,9 @@ int GDScriptLanguage::debug_get_stack_level_line(int p_level) const {
 		return _debug_parse_err_line;
 	}
 
-	ERR_FAIL_INDEX_V(p_level, _call_stack.stack_pos, -1);
+	ERR_FAIL_INDEX_V(p_level, _call_stack.stack_pos.load(std::memory_order_relaxed), -1);
 
-	int l = _call_stack.stack_pos - p_level - 1;
+	int l = _call_stack.stack_pos.load(std::memory_order_relaxed) - p_level - 1;
 
 	return *(_call_stack.levels[l].line);
 }
@@ -307,9 +307,9 @@ String GDScriptLanguage::debug_get_stack_level_function(int p_level) const {
 		return "";
 	}
 
-	ERR_FAIL_INDEX_V(p_level, _call_stack.stack_pos, "");
-	int l = _call_stack.stack_pos - p_level - 1;
-	return _call_stack.levels[l].function->get_name();
+	ERR_FAIL_INDEX_V(p_level, _call_stack.stack_pos.load(std::memory_order_relaxed), "");
+	int l = _call_stack.stack_pos.load(std::memory_order_relaxed) - p_level - 1;
+	return _call_stack.levels[l].function.load(std::memory_order_relaxed)->get_name();
 }
 
 String GDScriptLanguage::debug_get_stack_level_source(int p_level) const {
@@ -317,9 +317,9 @@ String GDScriptLanguage::debug_get_stack_level_source(int p_level) const {
 		return _debug_parse_err_file;
 	}
 
-	ERR_FAIL_INDEX_V(p_level, _call_stack.stack_pos, "");
-	int l = _call_stack.stack_pos - p_level - 1;
-	return _call_stack.levels[l].function->get_source();
+	ERR_FAIL_INDEX_V(p_level, _call_stack.stack_pos.load(std::memory_order_relaxed), "");
+	int l = _call_stack.stack_pos.load(std::memory_order_relaxed) - p_level - 1;
+	return _call_stack.levels[l].function.load(std::memory_order_relaxed)->get_source();
 }
 
 void GDScriptLanguage::debug_get_stack_level_locals(int p_level, List<String> *p_locals, List<Variant> *p_values, int p_max_subitems, int p_max_depth) {
@@ -327,10 +327,10 @@ void GDScriptLanguage::debug_get_stack_level_locals(int p_level, List<String> *p
 		return;
 	}
 
-	ERR_FAIL_INDEX(p_level, _call_stack.stack_pos);
-	int l = _call_stack.stack_pos - p_level - 1;
+	ERR_FAIL_INDEX(p_level, _call_stack.stack_pos.load(std::memory_order_relaxed));
+	int l = _call_stack.stack_pos.load(std::memory_order_relaxed) - p_level - 1;
 
-	GDScriptFunction *f = _call_stack.levels[l].function;
+	GDScriptFunction *f = _call_stack.levels[l].function.load(std::memory_order_relaxed);
 
 	List<Pair<StringName, int>> locals;
 
@@ -346,8 +346,8 @@ void GDScriptLanguage::debug_get_stack_level_members(int p_level, List<String> *
 		return;
 	}
 
-	ERR_FAIL_INDEX(p_level, _call_stack.stack_pos);
-	int l = _call_stack.stack_pos - p_level - 1;
+	ERR_FAIL_INDEX(p_level, _call_stack.stack_pos.load(std::memory_order_relaxed));
+	int l = _call_stack.stack_pos.load(std::memory_order_relaxed) - p_level - 1;
 
 	GDScriptInstance *instance = _call_stack.levels[l].instance;
 
@@ -371,9 +371,9 @@ ScriptInstance *GDScriptLanguage::debug_get_stack_level_instance(int p_level) {
 		return nullptr;
 	}
 
-	ERR_FAIL_INDEX_V(p_level, _call_stack.stack_pos, nullptr);
+	ERR_FAIL_INDEX_V(p_level, _call_stack.stack_pos.load(std::memory_order_relaxed), nullptr);
 
-	int l = _call_stack.stack_pos - p_level - 1;
+	int l = _call_stack.stack_pos.load(std::memory_order_relaxed) - p_level - 1;
 	ScriptInstance *instance = _call_stack.levels[l].instance;
 
 	return instance;
@@ -32,6 +32,8 @@
 
 #include "gdscript.h"
 
+SafeNumeric<uint32_t> GDScriptFunction::inline_cache_epoch;
+
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
 	return constants[p_idx];
@@ -121,6 +123,18 @@ GDScriptFunction::~GDScriptFunction() {
 		memdelete(lambdas[i]);
 	}
 
+	for (int i = 0; i < _inline_caches_count; i++) {
+		InlineCacheEntry *entry = _inline_caches_ptr[i].entry.load(std::memory_order_acquire);
+		while (entry) {
+			InlineCacheEntry *previous = entry->previous;
+			memdelete(entry);
+			entry = previous;
+		}
+	}
+	if (_inline_caches_ptr) {
+		memdelete_arr(_inline_caches_ptr);
+	}
+
 	for (int i = 0; i < argument_types.size(); i++) {
 		argument_types.write[i].script_type_ref = Ref<Script>();
 	}
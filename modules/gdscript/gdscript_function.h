@@ -265,9 +265,11 @@ public:
 		OPCODE_SET_KEYED,
 		OPCODE_SET_KEYED_VALIDATED,
 		OPCODE_SET_INDEXED_VALIDATED,
+		OPCODE_SET_INDEXED_TYPED_ARRAY,
 		OPCODE_GET_KEYED,
 		OPCODE_GET_KEYED_VALIDATED,
 		OPCODE_GET_INDEXED_VALIDATED,
+		OPCODE_GET_INDEXED_TYPED_ARRAY,
 		OPCODE_SET_NAMED,
 		OPCODE_SET_NAMED_VALIDATED,
 		OPCODE_GET_NAMED,
@@ -407,6 +409,13 @@ public:
 		OPCODE_TYPE_ADJUST_PACKED_VECTOR3_ARRAY,
 		OPCODE_TYPE_ADJUST_PACKED_COLOR_ARRAY,
 		OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY,
+		// Superinstructions, written over the first of two instructions by
+		// GDScriptByteCodeGenerator. The second one is kept, so it stays a valid jump target.
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,
+		OPCODE_OPERATOR_VALIDATED_ASSIGN,
+		OPCODE_GET_MEMBER_CALL_METHOD_BIND_VALIDATED_RETURN,
+		OPCODE_GET_MEMBER_CALL_METHOD_BIND_VALIDATED_NO_RETURN,
 		OPCODE_ASSERT,
 		OPCODE_BREAKPOINT,
 		OPCODE_LINE,
@@ -440,11 +449,35 @@ public:
 		StringName identifier;
 	};
 
+	// State handed to a function body translated to C++ ahead of time (see `GDScriptAOT`).
+	// The translated code only refers to slots and table indices, which are read from here.
+	struct AOTFrame {
+		Variant *stack = nullptr;
+		Variant *constants = nullptr;
+		Variant *members = nullptr;
+		Variant *result = nullptr;
+		int default_argument = 0;
+		const Variant::ValidatedOperatorEvaluator *operator_funcs = nullptr;
+		const Variant::ValidatedSetter *setters = nullptr;
+		const Variant::ValidatedGetter *getters = nullptr;
+		const Variant::ValidatedKeyedSetter *keyed_setters = nullptr;
+		const Variant::ValidatedKeyedGetter *keyed_getters = nullptr;
+		const Variant::ValidatedIndexedSetter *indexed_setters = nullptr;
+		const Variant::ValidatedIndexedGetter *indexed_getters = nullptr;
+		const Variant::ValidatedBuiltInMethod *builtin_methods = nullptr;
+		const Variant::ValidatedConstructor *constructors = nullptr;
+		const Variant::ValidatedUtilityFunction *utilities = nullptr;
+		MethodBind *const *methods = nullptr;
+	};
+
+	typedef void (*AOTFunction)(AOTFrame &p_frame);
+
 private:
 	friend class GDScript;
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
+	friend class GDScriptAOT;
 
 	StringName name;
 	StringName source;
@@ -519,6 +552,51 @@ private:
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
 
+	// Inline caches for untyped named access and calls. Every `OPCODE_GET_NAMED`, `OPCODE_SET_NAMED`
+	// and `OPCODE_CALL*` owns a slot that remembers how the last receiver resolved the name, keyed on
+	// its native class and GDScript. Entries are immutable once published so slots can be read from
+	// any thread; replaced entries are only freed with the function, so each slot is capped at
+	// `INLINE_CACHE_MAX_ENTRIES` of them.
+	struct InlineCacheEntry {
+		enum Kind {
+			GENERIC, // Resolved dynamically (script override, `_get()`, etc.), use the generic path.
+			SCRIPT_MEMBER,
+			NATIVE_PROPERTY,
+			NATIVE_METHOD,
+		};
+
+		Kind kind = GENERIC;
+		uint32_t epoch = 0;
+		StringName native_class;
+		const GDScript *script = nullptr;
+		int member_index = -1;
+		const GDScriptDataType *member_type = nullptr;
+		MethodBind *method = nullptr;
+		int property_index = -1;
+
+		InlineCacheEntry *previous = nullptr;
+		int updates = 0; // Distinct receivers seen.
+		int entries = 0; // Length of the chain, including this one.
+	};
+
+	struct InlineCache {
+		std::atomic<InlineCacheEntry *> entry = { nullptr };
+	};
+
+	enum InlineCacheAccess {
+		INLINE_CACHE_GET,
+		INLINE_CACHE_SET,
+		INLINE_CACHE_CALL,
+	};
+
+	static constexpr int INLINE_CACHE_MAX_UPDATES = 4; // Past this the site is megamorphic and stops updating.
+	static constexpr int INLINE_CACHE_MAX_ENTRIES = 16; // Refreshes after recompiles also stop here.
+
+	InlineCache *_inline_caches_ptr = nullptr;
+	int _inline_caches_count = 0;
+
+	AOTFunction _aot_function = nullptr;
+
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
 	const char *_func_cname = nullptr;
@@ -549,15 +627,32 @@ private:
 		} NativeProfile;
 		HashMap<String, NativeProfile> native_calls;
 		HashMap<String, NativeProfile> last_native_calls;
+		SafeNumeric<uint64_t> inline_cache_hits;
+		SafeNumeric<uint64_t> inline_cache_misses;
+		SafeNumeric<uint64_t> frame_inline_cache_hits;
+		SafeNumeric<uint64_t> frame_inline_cache_misses;
+		uint64_t last_frame_inline_cache_hits = 0;
+		uint64_t last_frame_inline_cache_misses = 0;
 	} profile;
 #endif
 
+	static bool _inline_cache_script_defines(const GDScript *p_script, const StringName &p_name, const StringName &p_hook);
+	static bool _get_inline_cache_receiver(Object *p_object, GDScriptInstance *&r_instance);
+	const InlineCacheEntry *_get_inline_cache_entry(int p_cache, InlineCacheAccess p_access, Object *p_object, GDScriptInstance *p_instance, const StringName &p_name);
+	void _update_inline_cache(int p_cache, InlineCacheAccess p_access, Object *p_object, GDScriptInstance *p_instance, const StringName &p_name);
+	bool _inline_cache_get(int p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret);
+	bool _inline_cache_set(int p_cache, const Variant *p_base, const StringName &p_name, const Variant &p_value, bool &r_valid);
+	bool _inline_cache_call(int p_cache, Variant *p_base, const StringName &p_name, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error);
+
 	_FORCE_INLINE_ String _get_call_error(const String &p_where, const Variant **p_argptrs, const Variant &p_ret, const Callable::CallError &p_err) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
 public:
 	static constexpr int MAX_CALL_DEPTH = 2048; // Limit to try to avoid crash because of a stack overflow.
 
+	// Hands out the per-script inline cache epochs, see `GDScript::inline_cache_epoch`.
+	static SafeNumeric<uint32_t> inline_cache_epoch;
+
 	struct CallState {
 		GDScript *script = nullptr;
 		GDScriptInstance *instance = nullptr;
@@ -887,6 +887,7 @@ void GDScriptParser::parse_extends() {
 			push_error(vformat(R"(Only strings or identifiers can be used after "extends", found "%s" instead.)", Variant::get_type_name(previous.literal.get_type())));
 		}
 		current_class->extends_path = previous.literal;
+		prefetch_paths.insert(current_class->extends_path);
 
 		if (!match(GDScriptTokenizer::Token::PERIOD)) {
 			return;
@@ -899,6 +900,9 @@ void GDScriptParser::parse_extends() {
 		return;
 	}
 	current_class->extends.push_back(parse_identifier());
+	if (current_class->extends[0] != nullptr) {
+		prefetch_class_names.insert(current_class->extends[0]->name);
+	}
 
 	while (match(GDScriptTokenizer::Token::PERIOD)) {
 		make_completion_context(COMPLETION_INHERIT_TYPE, current_class, chain_index++);
@@ -3397,6 +3401,8 @@ GDScriptParser::ExpressionNode *GDScriptParser::parse_preload(ExpressionNode *p_
 
 	if (preload->path == nullptr) {
 		push_error(R"(Expected resource path after "(".)");
+	} else if (preload->path->type == Node::LITERAL && static_cast<LiteralNode *>(preload->path)->value.get_type() == Variant::STRING) {
+		prefetch_paths.insert(static_cast<LiteralNode *>(preload->path)->value);
 	}
 
 	pop_completion_call();
@@ -3573,6 +3579,9 @@ GDScriptParser::TypeNode *GDScriptParser::parse_type(bool p_allow_void) {
 	}
 
 	IdentifierNode *type_element = parse_identifier();
+	if (type_element != nullptr) {
+		prefetch_class_names.insert(type_element->name);
+	}
 
 	type->type_chain.push_back(type_element);
 
@@ -1342,6 +1342,10 @@ private:
 	List<bool> multiline_stack;
 	HashMap<String, Ref<GDScriptParserRef>> depended_parsers;
 
+	// Dependencies visible without analysis, so other scripts can be parsed ahead of the analyzer.
+	HashSet<String> prefetch_paths; // From `extends` and `preload()` with a literal path, as written.
+	HashSet<StringName> prefetch_class_names; // From `extends` and type hints, may name global classes.
+
 	ClassNode *head = nullptr;
 	Node *list = nullptr;
 	List<ParserError> errors;
@@ -1579,6 +1583,8 @@ public:
 	bool is_tool() const { return _is_tool; }
 	Ref<GDScriptParserRef> get_depended_parser_for(const String &p_path);
 	const HashMap<String, Ref<GDScriptParserRef>> &get_depended_parsers();
+	const HashSet<String> &get_prefetch_paths() const { return prefetch_paths; }
+	const HashSet<StringName> &get_prefetch_class_names() const { return prefetch_class_names; }
 	ClassNode *find_class(const String &p_qualified_name) const;
 	bool has_class(const GDScriptParser::ClassNode *p_class) const;
 	static Variant::Type get_builtin_type(const StringName &p_type); // Excluding `Variant::NIL` and `Variant::OBJECT`.
@@ -0,0 +1,198 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "gdscript_sampling_profiler.h"
+
+#include "gdscript.h"
+
+#include "core/os/os.h"
+
+bool GDScriptSamplingProfiler::Stack::operator==(const Stack &p_other) const {
+	if (thread != p_other.thread || frames.size() != p_other.frames.size()) {
+		return false;
+	}
+	for (uint32_t i = 0; i < frames.size(); i++) {
+		if (frames[i] != p_other.frames[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint32_t GDScriptSamplingProfiler::StackHasher::hash(const Stack &p_stack) {
+	uint32_t h = hash_murmur3_one_64(p_stack.thread);
+	for (const GDScriptFunction *function : p_stack.frames) {
+		h = hash_murmur3_one_64((uint64_t)function, h);
+	}
+	return hash_fmix32(h);
+}
+
+void GDScriptSamplingProfiler::_thread_func(void *p_userdata) {
+	GDScriptSamplingProfiler *profiler = static_cast<GDScriptSamplingProfiler *>(p_userdata);
+	while (profiler->running.is_set()) {
+		OS::get_singleton()->delay_usec(profiler->interval_usec);
+		GDScriptLanguage::get_singleton()->profiling_sample_call_stacks(_sample_call_stack, profiler);
+	}
+}
+
+void GDScriptSamplingProfiler::_sample_call_stack(void *p_userdata, Thread::ID p_thread, GDScriptFunction *const *p_frames, int p_frame_count) {
+	static_cast<GDScriptSamplingProfiler *>(p_userdata)->add_sample(p_thread, p_frames, p_frame_count);
+}
+
+void GDScriptSamplingProfiler::add_sample(Thread::ID p_thread, const GDScriptFunction *const *p_frames, int p_frame_count) {
+	Stack stack;
+	stack.thread = p_thread;
+	stack.frames.resize(p_frame_count);
+	for (int i = 0; i < p_frame_count; i++) {
+		stack.frames[i] = p_frames[i];
+	}
+
+	MutexLock lock(samples_mutex);
+	HashMap<Stack, uint32_t, StackHasher>::Iterator E = samples.find(stack);
+	if (E) {
+		E->value++;
+	} else {
+		samples.insert(stack, 1);
+	}
+}
+
+void GDScriptSamplingProfiler::take_folded_stacks(Array &r_stacks) {
+	HashMap<Stack, uint32_t, StackHasher> taken;
+	{
+		MutexLock lock(samples_mutex);
+		SWAP(taken, samples);
+	}
+	if (taken.is_empty()) {
+		return;
+	}
+
+	HashMap<const GDScriptFunction *, StringName> signatures;
+	for (const KeyValue<Stack, uint32_t> &E : taken) {
+		for (const GDScriptFunction *function : E.key.frames) {
+			signatures.insert(function, StringName());
+		}
+	}
+	GDScriptLanguage::get_singleton()->profiling_resolve_functions(signatures);
+
+	// Different function pointers can share a signature once a script is reloaded, so merge by text.
+	HashMap<Thread::ID, HashMap<String, uint32_t>> folded;
+	for (const KeyValue<Stack, uint32_t> &E : taken) {
+		String text;
+		bool alive = true;
+		for (const GDScriptFunction *function : E.key.frames) {
+			const StringName &signature = signatures[function];
+			if (signature == StringName()) {
+				alive = false;
+				break;
+			}
+			if (!text.is_empty()) {
+				text += ";";
+			}
+			text += signature;
+		}
+		if (!alive) {
+			continue;
+		}
+		HashMap<String, uint32_t> &thread_stacks = folded[E.key.thread];
+		HashMap<String, uint32_t>::Iterator S = thread_stacks.find(text);
+		if (S) {
+			S->value += E.value;
+		} else {
+			thread_stacks.insert(text, E.value);
+		}
+	}
+
+	for (const KeyValue<Thread::ID, HashMap<String, uint32_t>> &T : folded) {
+		for (const KeyValue<String, uint32_t> &S : T.value) {
+			r_stacks.push_back(T.key);
+			r_stacks.push_back(S.key);
+			r_stacks.push_back(S.value);
+		}
+	}
+}
+
+void GDScriptSamplingProfiler::_flush() {
+	Array stacks;
+	take_folded_stacks(stacks);
+	if (stacks.is_empty()) {
+		return;
+	}
+
+	// The main thread is sent along so threads from process groups can be told apart from it.
+	Array data;
+	data.push_back(Thread::get_main_id());
+	data.push_back(interval_usec);
+	data.append_array(stacks);
+	EngineDebugger::get_singleton()->send_message("gdscript_sampler:stacks", data);
+}
+
+void GDScriptSamplingProfiler::toggle(bool p_enable, const Array &p_opts) {
+	if (p_enable) {
+		if (running.is_set()) {
+			return;
+		}
+		if (p_opts.size() > 0 && p_opts[0].get_type() == Variant::INT) {
+			interval_usec = MAX(100, int64_t(p_opts[0]));
+		}
+		{
+			MutexLock lock(samples_mutex);
+			samples.clear();
+		}
+		last_flush_usec = OS::get_singleton()->get_ticks_usec();
+		running.set();
+		thread.start(_thread_func, this);
+	} else {
+		if (!running.is_set()) {
+			return;
+		}
+		running.clear();
+		thread.wait_to_finish();
+		if (EngineDebugger::is_active()) {
+			_flush();
+		}
+	}
+}
+
+void GDScriptSamplingProfiler::tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+	const uint64_t now = OS::get_singleton()->get_ticks_usec();
+	if (now - last_flush_usec < FLUSH_INTERVAL_USEC) {
+		return;
+	}
+	last_flush_usec = now;
+	_flush();
+}
+
+GDScriptSamplingProfiler::~GDScriptSamplingProfiler() {
+	if (running.is_set()) {
+		running.clear();
+		thread.wait_to_finish();
+	}
+}
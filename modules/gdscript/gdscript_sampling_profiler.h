@@ -0,0 +1,85 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef GDSCRIPT_SAMPLING_PROFILER_H
+#define GDSCRIPT_SAMPLING_PROFILER_H
+
+#include "core/debugger/engine_profiler.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+class GDScriptFunction;
+
+// Samples the GDScript call stacks of every thread from a timer thread, rather than timing each call
+// like the "scripts" profiler does, so it costs nothing while disabled and little while enabled.
+// Stacks are streamed to the debugger in folded form ("outer;inner" with a count), ready for flame graphs.
+class GDScriptSamplingProfiler : public EngineProfiler {
+	struct Stack {
+		Thread::ID thread = Thread::UNASSIGNED_ID;
+		LocalVector<const GDScriptFunction *> frames; // Outermost first.
+
+		bool operator==(const Stack &p_other) const;
+	};
+
+	struct StackHasher {
+		static uint32_t hash(const Stack &p_stack);
+	};
+
+	Thread thread;
+	SafeFlag running;
+	uint64_t interval_usec = 1000;
+	uint64_t last_flush_usec = 0;
+
+	Mutex samples_mutex;
+	HashMap<Stack, uint32_t, StackHasher> samples;
+
+	static void _thread_func(void *p_userdata);
+	static void _sample_call_stack(void *p_userdata, Thread::ID p_thread, GDScriptFunction *const *p_frames, int p_frame_count);
+	void _flush();
+
+public:
+	static constexpr uint64_t FLUSH_INTERVAL_USEC = 250000;
+
+	void add_sample(Thread::ID p_thread, const GDScriptFunction *const *p_frames, int p_frame_count);
+	// Takes the samples gathered so far as [thread ID, folded stack, count] triplets.
+	// Frames of functions that were freed since they were sampled are dropped along with their stack.
+	void take_folded_stacks(Array &r_stacks);
+
+	virtual void toggle(bool p_enable, const Array &p_opts) override;
+	virtual void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) override;
+
+	~GDScriptSamplingProfiler();
+};
+
+#endif // GDSCRIPT_SAMPLING_PROFILER_H
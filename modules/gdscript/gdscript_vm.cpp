@@ -33,6 +33,7 @@
 #include "gdscript_lambda_callable.h"
 
 #include "core/os/os.h"
+#include "scene/scene_string_names.h"
 
 #ifdef DEBUG_ENABLED
 
@@ -115,6 +116,233 @@ void GDScriptFunction::_profile_native_call(uint64_t p_t_taken, const String &p_
 
 #endif // DEBUG_ENABLED
 
+bool GDScriptFunction::_inline_cache_script_defines(const GDScript *p_script, const StringName &p_name, const StringName &p_hook) {
+	if (p_script->member_indices.has(p_name)) {
+		return true;
+	}
+	for (const GDScript *scr = p_script; scr; scr = scr->_base) {
+		if (!scr->valid) {
+			return true;
+		}
+		if (scr->constants.has(p_name) || scr->static_variables_indices.has(p_name) || scr->_signals.has(p_name) || scr->member_functions.has(p_name) || scr->subclasses.has(p_name)) {
+			return true;
+		}
+		if (p_hook != StringName() && scr->member_functions.has(p_hook)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+_FORCE_INLINE_ bool GDScriptFunction::_get_inline_cache_receiver(Object *p_object, GDScriptInstance *&r_instance) {
+	ScriptInstance *script_instance = p_object->get_script_instance();
+	if (script_instance) {
+		if (script_instance->get_language() != GDScriptLanguage::get_singleton() || script_instance->is_placeholder()) {
+			return false;
+		}
+		r_instance = static_cast<GDScriptInstance *>(script_instance);
+	} else {
+		r_instance = nullptr;
+	}
+	return true;
+}
+
+void GDScriptFunction::_update_inline_cache(int p_cache, InlineCacheAccess p_access, Object *p_object, GDScriptInstance *p_instance, const StringName &p_name) {
+	InlineCache &cache = _inline_caches_ptr[p_cache];
+	InlineCacheEntry *previous = cache.entry.load(std::memory_order_acquire);
+
+	InlineCacheEntry entry;
+	entry.native_class = p_object->get_class_name();
+	entry.script = p_instance ? p_instance->script.ptr() : nullptr;
+	entry.epoch = entry.script ? entry.script->_get_inline_cache_epoch() : 0;
+
+	// Only new receivers count towards megamorphism, not the same one after its script was recompiled.
+	const bool refresh = previous && previous->script == entry.script && previous->native_class == entry.native_class;
+	const int updates = previous ? previous->updates + (refresh ? 0 : 1) : 1;
+	if (updates > INLINE_CACHE_MAX_UPDATES || (previous && previous->entries >= INLINE_CACHE_MAX_ENTRIES)) {
+		return;
+	}
+
+	const GDScript *script = entry.script;
+	StringName hook;
+	switch (p_access) {
+		case INLINE_CACHE_GET:
+			hook = GDScriptLanguage::get_singleton()->strings._get;
+			break;
+		case INLINE_CACHE_SET:
+			hook = GDScriptLanguage::get_singleton()->strings._set;
+			break;
+		case INLINE_CACHE_CALL:
+			break;
+	}
+
+	if (script && script->valid && p_access != INLINE_CACHE_CALL) {
+		const GDScript::MemberInfo *member = script->member_indices.getptr(p_name);
+		if (member && (p_access == INLINE_CACHE_GET ? !member->getter : !member->setter)) {
+			entry.kind = InlineCacheEntry::SCRIPT_MEMBER;
+			entry.member_index = member->index;
+			entry.member_type = &member->data_type;
+		}
+	}
+
+	// Extension classes can intercept any name, and their bindings may be reloaded.
+	ClassDB::APIType api = ClassDB::get_api_type(entry.native_class);
+	bool cacheable_class = api != ClassDB::API_EXTENSION && api != ClassDB::API_EDITOR_EXTENSION;
+
+	if (entry.kind == InlineCacheEntry::GENERIC && cacheable_class && !(script && _inline_cache_script_defines(script, p_name, hook))) {
+		if (p_access == INLINE_CACHE_CALL) {
+			if (p_name != CoreStringName(free_) && !(script && p_name == SceneStringName(_ready))) {
+				entry.method = ClassDB::get_method(entry.native_class, p_name);
+			}
+			if (entry.method) {
+				entry.kind = InlineCacheEntry::NATIVE_METHOD;
+			}
+		} else if (!ClassDB::has_method(entry.native_class, p_name) && !ClassDB::has_signal(entry.native_class, p_name) && !ClassDB::has_integer_constant(entry.native_class, p_name)) {
+			// Only plain properties, `ClassDB::get_property()` gives methods, signals and constants precedence.
+			StringName accessor = p_access == INLINE_CACHE_GET ? ClassDB::get_property_getter(entry.native_class, p_name) : ClassDB::get_property_setter(entry.native_class, p_name);
+			if (accessor != StringName() && !(script && _inline_cache_script_defines(script, accessor, StringName()))) {
+				entry.method = ClassDB::get_method(entry.native_class, accessor);
+			}
+			if (entry.method) {
+				entry.kind = InlineCacheEntry::NATIVE_PROPERTY;
+				entry.property_index = ClassDB::get_property_index(entry.native_class, p_name);
+			}
+		}
+	}
+
+	InlineCacheEntry *new_entry = memnew(InlineCacheEntry(entry));
+	new_entry->previous = previous;
+	new_entry->updates = updates;
+	new_entry->entries = previous ? previous->entries + 1 : 1;
+	if (!cache.entry.compare_exchange_strong(previous, new_entry, std::memory_order_acq_rel)) {
+		// Another thread updated the slot first, keep its entry.
+		memdelete(new_entry);
+	}
+}
+
+_FORCE_INLINE_ const GDScriptFunction::InlineCacheEntry *GDScriptFunction::_get_inline_cache_entry(int p_cache, InlineCacheAccess p_access, Object *p_object, GDScriptInstance *p_instance, const StringName &p_name) {
+	const InlineCacheEntry *entry = _inline_caches_ptr[p_cache].entry.load(std::memory_order_acquire);
+	const GDScript *script = p_instance ? p_instance->script.ptr() : nullptr;
+	bool hit = entry && entry->script == script && entry->native_class == p_object->get_class_name() && (!script || entry->epoch == script->_get_inline_cache_epoch());
+	if (!hit) {
+		_update_inline_cache(p_cache, p_access, p_object, p_instance, p_name);
+		entry = nullptr;
+	} else if (entry->kind == InlineCacheEntry::GENERIC) {
+		entry = nullptr;
+	}
+
+#ifdef DEBUG_ENABLED
+	if (unlikely(GDScriptLanguage::get_singleton()->profiling)) {
+		if (entry) {
+			profile.inline_cache_hits.increment();
+			profile.frame_inline_cache_hits.increment();
+		} else {
+			profile.inline_cache_misses.increment();
+			profile.frame_inline_cache_misses.increment();
+		}
+	}
+#endif
+	return entry;
+}
+
+_FORCE_INLINE_ bool GDScriptFunction::_inline_cache_get(int p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret) {
+	Object *obj = p_base->get_validated_object();
+	GDScriptInstance *instance = nullptr;
+	if (!obj || !_get_inline_cache_receiver(obj, instance)) {
+		return false;
+	}
+	const InlineCacheEntry *entry = _get_inline_cache_entry(p_cache, INLINE_CACHE_GET, obj, instance, p_name);
+	if (!entry) {
+		return false;
+	}
+
+	if (entry->kind == InlineCacheEntry::SCRIPT_MEMBER) {
+		if (unlikely(entry->member_index >= instance->members.size())) {
+			return false;
+		}
+		r_ret = instance->members[entry->member_index];
+		return true;
+	}
+	if (entry->kind == InlineCacheEntry::NATIVE_PROPERTY) {
+		Callable::CallError ce;
+		if (entry->property_index >= 0) {
+			Variant index = entry->property_index;
+			const Variant *arg[1] = { &index };
+			const Variant value = entry->method->call(obj, arg, 1, ce);
+			r_ret = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
+		} else {
+			r_ret = entry->method->call(obj, nullptr, 0, ce);
+		}
+		return true;
+	}
+	return false;
+}
+
+_FORCE_INLINE_ bool GDScriptFunction::_inline_cache_set(int p_cache, const Variant *p_base, const StringName &p_name, const Variant &p_value, bool &r_valid) {
+	Object *obj = p_base->get_validated_object();
+	GDScriptInstance *instance = nullptr;
+	if (!obj || !_get_inline_cache_receiver(obj, instance)) {
+		return false;
+	}
+	const InlineCacheEntry *entry = _get_inline_cache_entry(p_cache, INLINE_CACHE_SET, obj, instance, p_name);
+	if (!entry) {
+		return false;
+	}
+
+	if (entry->kind == InlineCacheEntry::SCRIPT_MEMBER) {
+		// Values that need a conversion go through `GDScriptInstance::set()`.
+		if (unlikely(entry->member_index >= instance->members.size()) || (entry->member_type->has_type && !entry->member_type->is_type(p_value))) {
+			return false;
+		}
+		instance->members.write[entry->member_index] = p_value;
+		r_valid = true;
+	} else if (entry->kind == InlineCacheEntry::NATIVE_PROPERTY) {
+		Callable::CallError ce;
+		if (entry->property_index >= 0) {
+			Variant index = entry->property_index;
+			const Variant *args[2] = { &index, &p_value };
+			entry->method->call(obj, args, 2, ce);
+		} else {
+			const Variant *args[1] = { &p_value };
+			entry->method->call(obj, args, 1, ce);
+		}
+		r_valid = ce.error == Callable::CallError::CALL_OK;
+	} else {
+		return false;
+	}
+
+#ifdef TOOLS_ENABLED
+	obj->set_edited(true);
+#endif
+	return true;
+}
+
+_FORCE_INLINE_ bool GDScriptFunction::_inline_cache_call(int p_cache, Variant *p_base, const StringName &p_name, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return false;
+	}
+#ifdef DEBUG_ENABLED
+	Object *obj = p_base->get_validated_object();
+#else
+	Object *obj = *VariantInternal::get_object(p_base);
+#endif
+	GDScriptInstance *instance = nullptr;
+	if (!obj || !_get_inline_cache_receiver(obj, instance)) {
+		return false;
+	}
+	const InlineCacheEntry *entry = _get_inline_cache_entry(p_cache, INLINE_CACHE_CALL, obj, instance, p_name);
+	if (!entry || entry->kind != InlineCacheEntry::NATIVE_METHOD) {
+		return false;
+	}
+
+	r_error.error = Callable::CallError::CALL_OK;
+#ifdef DEBUG_ENABLED
+	_ObjectDebugLock debug_lock(obj); // Like `Object::callp()`.
+#endif
+	r_ret = entry->method->call(obj, p_args, p_argcount, r_error);
+	return true;
+}
+
 Variant GDScriptFunction::_get_default_variant_for_data_type(const GDScriptDataType &p_data_type) {
 	if (p_data_type.kind == GDScriptDataType::BUILTIN) {
 		if (p_data_type.builtin_type == Variant::ARRAY) {
@@ -228,165 +456,172 @@ void (*type_init_function_table[])(Variant *) = {
 };
 
 #if defined(__GNUC__) || defined(__clang__)
-#define OPCODES_TABLE                                    \
-	static const void *switch_table_ops[] = {            \
-		&&OPCODE_OPERATOR,                               \
-		&&OPCODE_OPERATOR_VALIDATED,                     \
-		&&OPCODE_TYPE_TEST_BUILTIN,                      \
-		&&OPCODE_TYPE_TEST_ARRAY,                        \
-		&&OPCODE_TYPE_TEST_DICTIONARY,                   \
-		&&OPCODE_TYPE_TEST_NATIVE,                       \
-		&&OPCODE_TYPE_TEST_SCRIPT,                       \
-		&&OPCODE_SET_KEYED,                              \
-		&&OPCODE_SET_KEYED_VALIDATED,                    \
-		&&OPCODE_SET_INDEXED_VALIDATED,                  \
-		&&OPCODE_GET_KEYED,                              \
-		&&OPCODE_GET_KEYED_VALIDATED,                    \
-		&&OPCODE_GET_INDEXED_VALIDATED,                  \
-		&&OPCODE_SET_NAMED,                              \
-		&&OPCODE_SET_NAMED_VALIDATED,                    \
-		&&OPCODE_GET_NAMED,                              \
-		&&OPCODE_GET_NAMED_VALIDATED,                    \
-		&&OPCODE_SET_MEMBER,                             \
-		&&OPCODE_GET_MEMBER,                             \
-		&&OPCODE_SET_STATIC_VARIABLE,                    \
-		&&OPCODE_GET_STATIC_VARIABLE,                    \
-		&&OPCODE_ASSIGN,                                 \
-		&&OPCODE_ASSIGN_NULL,                            \
-		&&OPCODE_ASSIGN_TRUE,                            \
-		&&OPCODE_ASSIGN_FALSE,                           \
-		&&OPCODE_ASSIGN_TYPED_BUILTIN,                   \
-		&&OPCODE_ASSIGN_TYPED_ARRAY,                     \
-		&&OPCODE_ASSIGN_TYPED_DICTIONARY,                \
-		&&OPCODE_ASSIGN_TYPED_NATIVE,                    \
-		&&OPCODE_ASSIGN_TYPED_SCRIPT,                    \
-		&&OPCODE_CAST_TO_BUILTIN,                        \
-		&&OPCODE_CAST_TO_NATIVE,                         \
-		&&OPCODE_CAST_TO_SCRIPT,                         \
-		&&OPCODE_CONSTRUCT,                              \
-		&&OPCODE_CONSTRUCT_VALIDATED,                    \
-		&&OPCODE_CONSTRUCT_ARRAY,                        \
-		&&OPCODE_CONSTRUCT_TYPED_ARRAY,                  \
-		&&OPCODE_CONSTRUCT_DICTIONARY,                   \
-		&&OPCODE_CONSTRUCT_TYPED_DICTIONARY,             \
-		&&OPCODE_CALL,                                   \
-		&&OPCODE_CALL_RETURN,                            \
-		&&OPCODE_CALL_ASYNC,                             \
-		&&OPCODE_CALL_UTILITY,                           \
-		&&OPCODE_CALL_UTILITY_VALIDATED,                 \
-		&&OPCODE_CALL_GDSCRIPT_UTILITY,                  \
-		&&OPCODE_CALL_BUILTIN_TYPE_VALIDATED,            \
-		&&OPCODE_CALL_SELF_BASE,                         \
-		&&OPCODE_CALL_METHOD_BIND,                       \
-		&&OPCODE_CALL_METHOD_BIND_RET,                   \
-		&&OPCODE_CALL_BUILTIN_STATIC,                    \
-		&&OPCODE_CALL_NATIVE_STATIC,                     \
-		&&OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN,    \
-		&&OPCODE_CALL_NATIVE_STATIC_VALIDATED_NO_RETURN, \
-		&&OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN,      \
-		&&OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN,   \
-		&&OPCODE_AWAIT,                                  \
-		&&OPCODE_AWAIT_RESUME,                           \
-		&&OPCODE_CREATE_LAMBDA,                          \
-		&&OPCODE_CREATE_SELF_LAMBDA,                     \
-		&&OPCODE_JUMP,                                   \
-		&&OPCODE_JUMP_IF,                                \
-		&&OPCODE_JUMP_IF_NOT,                            \
-		&&OPCODE_JUMP_TO_DEF_ARGUMENT,                   \
-		&&OPCODE_JUMP_IF_SHARED,                         \
-		&&OPCODE_RETURN,                                 \
-		&&OPCODE_RETURN_TYPED_BUILTIN,                   \
-		&&OPCODE_RETURN_TYPED_ARRAY,                     \
-		&&OPCODE_RETURN_TYPED_DICTIONARY,                \
-		&&OPCODE_RETURN_TYPED_NATIVE,                    \
-		&&OPCODE_RETURN_TYPED_SCRIPT,                    \
-		&&OPCODE_ITERATE_BEGIN,                          \
-		&&OPCODE_ITERATE_BEGIN_INT,                      \
-		&&OPCODE_ITERATE_BEGIN_FLOAT,                    \
-		&&OPCODE_ITERATE_BEGIN_VECTOR2,                  \
-		&&OPCODE_ITERATE_BEGIN_VECTOR2I,                 \
-		&&OPCODE_ITERATE_BEGIN_VECTOR3,                  \
-		&&OPCODE_ITERATE_BEGIN_VECTOR3I,                 \
-		&&OPCODE_ITERATE_BEGIN_STRING,                   \
-		&&OPCODE_ITERATE_BEGIN_DICTIONARY,               \
-		&&OPCODE_ITERATE_BEGIN_ARRAY,                    \
-		&&OPCODE_ITERATE_BEGIN_PACKED_BYTE_ARRAY,        \
-		&&OPCODE_ITERATE_BEGIN_PACKED_INT32_ARRAY,       \
-		&&OPCODE_ITERATE_BEGIN_PACKED_INT64_ARRAY,       \
-		&&OPCODE_ITERATE_BEGIN_PACKED_FLOAT32_ARRAY,     \
-		&&OPCODE_ITERATE_BEGIN_PACKED_FLOAT64_ARRAY,     \
-		&&OPCODE_ITERATE_BEGIN_PACKED_STRING_ARRAY,      \
-		&&OPCODE_ITERATE_BEGIN_PACKED_VECTOR2_ARRAY,     \
-		&&OPCODE_ITERATE_BEGIN_PACKED_VECTOR3_ARRAY,     \
-		&&OPCODE_ITERATE_BEGIN_PACKED_COLOR_ARRAY,       \
-		&&OPCODE_ITERATE_BEGIN_PACKED_VECTOR4_ARRAY,     \
-		&&OPCODE_ITERATE_BEGIN_OBJECT,                   \
-		&&OPCODE_ITERATE,                                \
-		&&OPCODE_ITERATE_INT,                            \
-		&&OPCODE_ITERATE_FLOAT,                          \
-		&&OPCODE_ITERATE_VECTOR2,                        \
-		&&OPCODE_ITERATE_VECTOR2I,                       \
-		&&OPCODE_ITERATE_VECTOR3,                        \
-		&&OPCODE_ITERATE_VECTOR3I,                       \
-		&&OPCODE_ITERATE_STRING,                         \
-		&&OPCODE_ITERATE_DICTIONARY,                     \
-		&&OPCODE_ITERATE_ARRAY,                          \
-		&&OPCODE_ITERATE_PACKED_BYTE_ARRAY,              \
-		&&OPCODE_ITERATE_PACKED_INT32_ARRAY,             \
-		&&OPCODE_ITERATE_PACKED_INT64_ARRAY,             \
-		&&OPCODE_ITERATE_PACKED_FLOAT32_ARRAY,           \
-		&&OPCODE_ITERATE_PACKED_FLOAT64_ARRAY,           \
-		&&OPCODE_ITERATE_PACKED_STRING_ARRAY,            \
-		&&OPCODE_ITERATE_PACKED_VECTOR2_ARRAY,           \
-		&&OPCODE_ITERATE_PACKED_VECTOR3_ARRAY,           \
-		&&OPCODE_ITERATE_PACKED_COLOR_ARRAY,             \
-		&&OPCODE_ITERATE_PACKED_VECTOR4_ARRAY,           \
-		&&OPCODE_ITERATE_OBJECT,                         \
-		&&OPCODE_STORE_GLOBAL,                           \
-		&&OPCODE_STORE_NAMED_GLOBAL,                     \
-		&&OPCODE_TYPE_ADJUST_BOOL,                       \
-		&&OPCODE_TYPE_ADJUST_INT,                        \
-		&&OPCODE_TYPE_ADJUST_FLOAT,                      \
-		&&OPCODE_TYPE_ADJUST_STRING,                     \
-		&&OPCODE_TYPE_ADJUST_VECTOR2,                    \
-		&&OPCODE_TYPE_ADJUST_VECTOR2I,                   \
-		&&OPCODE_TYPE_ADJUST_RECT2,                      \
-		&&OPCODE_TYPE_ADJUST_RECT2I,                     \
-		&&OPCODE_TYPE_ADJUST_VECTOR3,                    \
-		&&OPCODE_TYPE_ADJUST_VECTOR3I,                   \
-		&&OPCODE_TYPE_ADJUST_TRANSFORM2D,                \
-		&&OPCODE_TYPE_ADJUST_VECTOR4,                    \
-		&&OPCODE_TYPE_ADJUST_VECTOR4I,                   \
-		&&OPCODE_TYPE_ADJUST_PLANE,                      \
-		&&OPCODE_TYPE_ADJUST_QUATERNION,                 \
-		&&OPCODE_TYPE_ADJUST_AABB,                       \
-		&&OPCODE_TYPE_ADJUST_BASIS,                      \
-		&&OPCODE_TYPE_ADJUST_TRANSFORM3D,                \
-		&&OPCODE_TYPE_ADJUST_PROJECTION,                 \
-		&&OPCODE_TYPE_ADJUST_COLOR,                      \
-		&&OPCODE_TYPE_ADJUST_STRING_NAME,                \
-		&&OPCODE_TYPE_ADJUST_NODE_PATH,                  \
-		&&OPCODE_TYPE_ADJUST_RID,                        \
-		&&OPCODE_TYPE_ADJUST_OBJECT,                     \
-		&&OPCODE_TYPE_ADJUST_CALLABLE,                   \
-		&&OPCODE_TYPE_ADJUST_SIGNAL,                     \
-		&&OPCODE_TYPE_ADJUST_DICTIONARY,                 \
-		&&OPCODE_TYPE_ADJUST_ARRAY,                      \
-		&&OPCODE_TYPE_ADJUST_PACKED_BYTE_ARRAY,          \
-		&&OPCODE_TYPE_ADJUST_PACKED_INT32_ARRAY,         \
-		&&OPCODE_TYPE_ADJUST_PACKED_INT64_ARRAY,         \
-		&&OPCODE_TYPE_ADJUST_PACKED_FLOAT32_ARRAY,       \
-		&&OPCODE_TYPE_ADJUST_PACKED_FLOAT64_ARRAY,       \
-		&&OPCODE_TYPE_ADJUST_PACKED_STRING_ARRAY,        \
-		&&OPCODE_TYPE_ADJUST_PACKED_VECTOR2_ARRAY,       \
-		&&OPCODE_TYPE_ADJUST_PACKED_VECTOR3_ARRAY,       \
-		&&OPCODE_TYPE_ADJUST_PACKED_COLOR_ARRAY,         \
-		&&OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY,       \
-		&&OPCODE_ASSERT,                                 \
-		&&OPCODE_BREAKPOINT,                             \
-		&&OPCODE_LINE,                                   \
-		&&OPCODE_END                                     \
-	};                                                   \
+#define OPCODES_TABLE                                             \
+	static const void *switch_table_ops[] = {                     \
+		&&OPCODE_OPERATOR,                                        \
+		&&OPCODE_OPERATOR_VALIDATED,                              \
+		&&OPCODE_TYPE_TEST_BUILTIN,                               \
+		&&OPCODE_TYPE_TEST_ARRAY,                                 \
+		&&OPCODE_TYPE_TEST_DICTIONARY,                            \
+		&&OPCODE_TYPE_TEST_NATIVE,                                \
+		&&OPCODE_TYPE_TEST_SCRIPT,                                \
+		&&OPCODE_SET_KEYED,                                       \
+		&&OPCODE_SET_KEYED_VALIDATED,                             \
+		&&OPCODE_SET_INDEXED_VALIDATED,                           \
+		&&OPCODE_SET_INDEXED_TYPED_ARRAY,                         \
+		&&OPCODE_GET_KEYED,                                       \
+		&&OPCODE_GET_KEYED_VALIDATED,                             \
+		&&OPCODE_GET_INDEXED_VALIDATED,                           \
+		&&OPCODE_GET_INDEXED_TYPED_ARRAY,                         \
+		&&OPCODE_SET_NAMED,                                       \
+		&&OPCODE_SET_NAMED_VALIDATED,                             \
+		&&OPCODE_GET_NAMED,                                       \
+		&&OPCODE_GET_NAMED_VALIDATED,                             \
+		&&OPCODE_SET_MEMBER,                                      \
+		&&OPCODE_GET_MEMBER,                                      \
+		&&OPCODE_SET_STATIC_VARIABLE,                             \
+		&&OPCODE_GET_STATIC_VARIABLE,                             \
+		&&OPCODE_ASSIGN,                                          \
+		&&OPCODE_ASSIGN_NULL,                                     \
+		&&OPCODE_ASSIGN_TRUE,                                     \
+		&&OPCODE_ASSIGN_FALSE,                                    \
+		&&OPCODE_ASSIGN_TYPED_BUILTIN,                            \
+		&&OPCODE_ASSIGN_TYPED_ARRAY,                              \
+		&&OPCODE_ASSIGN_TYPED_DICTIONARY,                         \
+		&&OPCODE_ASSIGN_TYPED_NATIVE,                             \
+		&&OPCODE_ASSIGN_TYPED_SCRIPT,                             \
+		&&OPCODE_CAST_TO_BUILTIN,                                 \
+		&&OPCODE_CAST_TO_NATIVE,                                  \
+		&&OPCODE_CAST_TO_SCRIPT,                                  \
+		&&OPCODE_CONSTRUCT,                                       \
+		&&OPCODE_CONSTRUCT_VALIDATED,                             \
+		&&OPCODE_CONSTRUCT_ARRAY,                                 \
+		&&OPCODE_CONSTRUCT_TYPED_ARRAY,                           \
+		&&OPCODE_CONSTRUCT_DICTIONARY,                            \
+		&&OPCODE_CONSTRUCT_TYPED_DICTIONARY,                      \
+		&&OPCODE_CALL,                                            \
+		&&OPCODE_CALL_RETURN,                                     \
+		&&OPCODE_CALL_ASYNC,                                      \
+		&&OPCODE_CALL_UTILITY,                                    \
+		&&OPCODE_CALL_UTILITY_VALIDATED,                          \
+		&&OPCODE_CALL_GDSCRIPT_UTILITY,                           \
+		&&OPCODE_CALL_BUILTIN_TYPE_VALIDATED,                     \
+		&&OPCODE_CALL_SELF_BASE,                                  \
+		&&OPCODE_CALL_METHOD_BIND,                                \
+		&&OPCODE_CALL_METHOD_BIND_RET,                            \
+		&&OPCODE_CALL_BUILTIN_STATIC,                             \
+		&&OPCODE_CALL_NATIVE_STATIC,                              \
+		&&OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN,             \
+		&&OPCODE_CALL_NATIVE_STATIC_VALIDATED_NO_RETURN,          \
+		&&OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN,               \
+		&&OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN,            \
+		&&OPCODE_AWAIT,                                           \
+		&&OPCODE_AWAIT_RESUME,                                    \
+		&&OPCODE_CREATE_LAMBDA,                                   \
+		&&OPCODE_CREATE_SELF_LAMBDA,                              \
+		&&OPCODE_JUMP,                                            \
+		&&OPCODE_JUMP_IF,                                         \
+		&&OPCODE_JUMP_IF_NOT,                                     \
+		&&OPCODE_JUMP_TO_DEF_ARGUMENT,                            \
+		&&OPCODE_JUMP_IF_SHARED,                                  \
+		&&OPCODE_RETURN,                                          \
+		&&OPCODE_RETURN_TYPED_BUILTIN,                            \
+		&&OPCODE_RETURN_TYPED_ARRAY,                              \
+		&&OPCODE_RETURN_TYPED_DICTIONARY,                         \
+		&&OPCODE_RETURN_TYPED_NATIVE,                             \
+		&&OPCODE_RETURN_TYPED_SCRIPT,                             \
+		&&OPCODE_ITERATE_BEGIN,                                   \
+		&&OPCODE_ITERATE_BEGIN_INT,                               \
+		&&OPCODE_ITERATE_BEGIN_FLOAT,                             \
+		&&OPCODE_ITERATE_BEGIN_VECTOR2,                           \
+		&&OPCODE_ITERATE_BEGIN_VECTOR2I,                          \
+		&&OPCODE_ITERATE_BEGIN_VECTOR3,                           \
+		&&OPCODE_ITERATE_BEGIN_VECTOR3I,                          \
+		&&OPCODE_ITERATE_BEGIN_STRING,                            \
+		&&OPCODE_ITERATE_BEGIN_DICTIONARY,                        \
+		&&OPCODE_ITERATE_BEGIN_ARRAY,                             \
+		&&OPCODE_ITERATE_BEGIN_PACKED_BYTE_ARRAY,                 \
+		&&OPCODE_ITERATE_BEGIN_PACKED_INT32_ARRAY,                \
+		&&OPCODE_ITERATE_BEGIN_PACKED_INT64_ARRAY,                \
+		&&OPCODE_ITERATE_BEGIN_PACKED_FLOAT32_ARRAY,              \
+		&&OPCODE_ITERATE_BEGIN_PACKED_FLOAT64_ARRAY,              \
+		&&OPCODE_ITERATE_BEGIN_PACKED_STRING_ARRAY,               \
+		&&OPCODE_ITERATE_BEGIN_PACKED_VECTOR2_ARRAY,              \
+		&&OPCODE_ITERATE_BEGIN_PACKED_VECTOR3_ARRAY,              \
+		&&OPCODE_ITERATE_BEGIN_PACKED_COLOR_ARRAY,                \
+		&&OPCODE_ITERATE_BEGIN_PACKED_VECTOR4_ARRAY,              \
+		&&OPCODE_ITERATE_BEGIN_OBJECT,                            \
+		&&OPCODE_ITERATE,                                         \
+		&&OPCODE_ITERATE_INT,                                     \
+		&&OPCODE_ITERATE_FLOAT,                                   \
+		&&OPCODE_ITERATE_VECTOR2,                                 \
+		&&OPCODE_ITERATE_VECTOR2I,                                \
+		&&OPCODE_ITERATE_VECTOR3,                                 \
+		&&OPCODE_ITERATE_VECTOR3I,                                \
+		&&OPCODE_ITERATE_STRING,                                  \
+		&&OPCODE_ITERATE_DICTIONARY,                              \
+		&&OPCODE_ITERATE_ARRAY,                                   \
+		&&OPCODE_ITERATE_PACKED_BYTE_ARRAY,                       \
+		&&OPCODE_ITERATE_PACKED_INT32_ARRAY,                      \
+		&&OPCODE_ITERATE_PACKED_INT64_ARRAY,                      \
+		&&OPCODE_ITERATE_PACKED_FLOAT32_ARRAY,                    \
+		&&OPCODE_ITERATE_PACKED_FLOAT64_ARRAY,                    \
+		&&OPCODE_ITERATE_PACKED_STRING_ARRAY,                     \
+		&&OPCODE_ITERATE_PACKED_VECTOR2_ARRAY,                    \
+		&&OPCODE_ITERATE_PACKED_VECTOR3_ARRAY,                    \
+		&&OPCODE_ITERATE_PACKED_COLOR_ARRAY,                      \
+		&&OPCODE_ITERATE_PACKED_VECTOR4_ARRAY,                    \
+		&&OPCODE_ITERATE_OBJECT,                                  \
+		&&OPCODE_STORE_GLOBAL,                                    \
+		&&OPCODE_STORE_NAMED_GLOBAL,                              \
+		&&OPCODE_TYPE_ADJUST_BOOL,                                \
+		&&OPCODE_TYPE_ADJUST_INT,                                 \
+		&&OPCODE_TYPE_ADJUST_FLOAT,                               \
+		&&OPCODE_TYPE_ADJUST_STRING,                              \
+		&&OPCODE_TYPE_ADJUST_VECTOR2,                             \
+		&&OPCODE_TYPE_ADJUST_VECTOR2I,                            \
+		&&OPCODE_TYPE_ADJUST_RECT2,                               \
+		&&OPCODE_TYPE_ADJUST_RECT2I,                              \
+		&&OPCODE_TYPE_ADJUST_VECTOR3,                             \
+		&&OPCODE_TYPE_ADJUST_VECTOR3I,                            \
+		&&OPCODE_TYPE_ADJUST_TRANSFORM2D,                         \
+		&&OPCODE_TYPE_ADJUST_VECTOR4,                             \
+		&&OPCODE_TYPE_ADJUST_VECTOR4I,                            \
+		&&OPCODE_TYPE_ADJUST_PLANE,                               \
+		&&OPCODE_TYPE_ADJUST_QUATERNION,                          \
+		&&OPCODE_TYPE_ADJUST_AABB,                                \
+		&&OPCODE_TYPE_ADJUST_BASIS,                               \
+		&&OPCODE_TYPE_ADJUST_TRANSFORM3D,                         \
+		&&OPCODE_TYPE_ADJUST_PROJECTION,                          \
+		&&OPCODE_TYPE_ADJUST_COLOR,                               \
+		&&OPCODE_TYPE_ADJUST_STRING_NAME,                         \
+		&&OPCODE_TYPE_ADJUST_NODE_PATH,                           \
+		&&OPCODE_TYPE_ADJUST_RID,                                 \
+		&&OPCODE_TYPE_ADJUST_OBJECT,                              \
+		&&OPCODE_TYPE_ADJUST_CALLABLE,                            \
+		&&OPCODE_TYPE_ADJUST_SIGNAL,                              \
+		&&OPCODE_TYPE_ADJUST_DICTIONARY,                          \
+		&&OPCODE_TYPE_ADJUST_ARRAY,                               \
+		&&OPCODE_TYPE_ADJUST_PACKED_BYTE_ARRAY,                   \
+		&&OPCODE_TYPE_ADJUST_PACKED_INT32_ARRAY,                  \
+		&&OPCODE_TYPE_ADJUST_PACKED_INT64_ARRAY,                  \
+		&&OPCODE_TYPE_ADJUST_PACKED_FLOAT32_ARRAY,                \
+		&&OPCODE_TYPE_ADJUST_PACKED_FLOAT64_ARRAY,                \
+		&&OPCODE_TYPE_ADJUST_PACKED_STRING_ARRAY,                 \
+		&&OPCODE_TYPE_ADJUST_PACKED_VECTOR2_ARRAY,                \
+		&&OPCODE_TYPE_ADJUST_PACKED_VECTOR3_ARRAY,                \
+		&&OPCODE_TYPE_ADJUST_PACKED_COLOR_ARRAY,                  \
+		&&OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY,                \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF,                      \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,                  \
+		&&OPCODE_OPERATOR_VALIDATED_ASSIGN,                       \
+		&&OPCODE_GET_MEMBER_CALL_METHOD_BIND_VALIDATED_RETURN,    \
+		&&OPCODE_GET_MEMBER_CALL_METHOD_BIND_VALIDATED_NO_RETURN, \
+		&&OPCODE_ASSERT,                                          \
+		&&OPCODE_BREAKPOINT,                                      \
+		&&OPCODE_LINE,                                            \
+		&&OPCODE_END                                              \
+	};                                                            \
 	static_assert((sizeof(switch_table_ops) / sizeof(switch_table_ops[0]) == (OPCODE_END + 1)), "Opcodes in jump table aren't the same as opcodes in enum.");
 
 #define OPCODE(m_op) \
@@ -406,6 +641,15 @@ void (*type_init_function_table[])(Variant *) = {
 #define DISPATCH_OPCODE goto *switch_table_ops[_code_ptr[ip]]
 #endif // DEBUG_ENABLED
 
+// Goes straight to the handler of the next instruction, when a superinstruction knows what it is.
+#ifdef DEBUG_ENABLED
+#define OPCODE_CHAIN(m_op) \
+	last_opcode = m_op;    \
+	goto m_op
+#else // !DEBUG_ENABLED
+#define OPCODE_CHAIN(m_op) goto m_op
+#endif // DEBUG_ENABLED
+
 #define OPCODE_BREAK goto OPSEXIT
 #define OPCODE_OUT goto OPSOUT
 #else // !(defined(__GNUC__) || defined(__clang__))
@@ -415,6 +659,7 @@ void (*type_init_function_table[])(Variant *) = {
 #define OPCODES_END
 #define OPCODES_OUT
 #define DISPATCH_OPCODE continue
+#define OPCODE_CHAIN(m_op) continue
 
 #ifdef _MSC_VER
 #define OPCODE_SWITCH(m_test)       \
@@ -710,6 +955,31 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 	Variant *variant_addresses[ADDR_TYPE_MAX] = { stack, _constants_ptr, p_instance ? p_instance->members.ptrw() : nullptr };
 
+#ifndef DEBUG_ENABLED
+	if (_aot_function && !p_state) {
+		// Translated ahead of time, run the native body and leave through `OPCODE_END`.
+		AOTFrame frame;
+		frame.stack = stack;
+		frame.constants = _constants_ptr;
+		frame.members = variant_addresses[ADDR_TYPE_MEMBER];
+		frame.result = &retvalue;
+		frame.default_argument = defarg;
+		frame.operator_funcs = _operator_funcs_ptr;
+		frame.setters = _setters_ptr;
+		frame.getters = _getters_ptr;
+		frame.keyed_setters = _keyed_setters_ptr;
+		frame.keyed_getters = _keyed_getters_ptr;
+		frame.indexed_setters = _indexed_setters_ptr;
+		frame.indexed_getters = _indexed_getters_ptr;
+		frame.builtin_methods = _builtin_methods_ptr;
+		frame.constructors = _constructors_ptr;
+		frame.utilities = _utilities_ptr;
+		frame.methods = _methods_ptr;
+		_aot_function(frame);
+		ip = _code_size - 1;
+	}
+#endif
+
 #ifdef DEBUG_ENABLED
 	OPCODE_WHILE(ip < _code_size) {
 		int last_opcode = _code_ptr[ip];
@@ -822,6 +1092,50 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_OPERATOR_VALIDATED_JUMP(m_op, m_jump_if)                                        \
+	OPCODE(m_op) {                                                                             \
+		CHECK_SPACE(8);                                                                        \
+		int operator_idx = _code_ptr[ip + 4];                                                  \
+		GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);               \
+		Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx]; \
+		GET_VARIANT_PTR(a, 0);                                                                 \
+		GET_VARIANT_PTR(b, 1);                                                                 \
+		GET_VARIANT_PTR(dst, 2);                                                               \
+		operator_func(a, b, dst);                                                              \
+		if (dst->booleanize() == m_jump_if) {                                                  \
+			int to = _code_ptr[ip + 7];                                                        \
+			GD_ERR_BREAK(to < 0 || to > _code_size);                                           \
+			ip = to;                                                                           \
+		} else {                                                                               \
+			ip += 8;                                                                           \
+		}                                                                                      \
+	}                                                                                          \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_VALIDATED_JUMP(OPCODE_OPERATOR_VALIDATED_JUMP_IF, true);
+			OPCODE_OPERATOR_VALIDATED_JUMP(OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT, false);
+
+			OPCODE(OPCODE_OPERATOR_VALIDATED_ASSIGN) {
+				CHECK_SPACE(8);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				operator_func(a, b, dst);
+
+				// The assignment at ip + 5 copies dst.
+				GET_VARIANT_PTR(assign_dst, 5);
+				*assign_dst = *dst;
+
+				ip += 8;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1061,6 +1375,37 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_SET_INDEXED_TYPED_ARRAY) {
+				CHECK_SPACE(4);
+
+				GET_VARIANT_PTR(dst, 0);
+				GET_VARIANT_PTR(index, 1);
+				GET_VARIANT_PTR(value, 2);
+
+				// The compiler proved the value matches the element type, so skip the validation `Array::set()` does.
+				Array *array = VariantInternal::get_array(dst);
+				int64_t int_index = *VariantInternal::get_int(index);
+				const int64_t size = array->size();
+				if (int_index < 0) {
+					int_index += size;
+				}
+
+				if (unlikely(int_index < 0 || int_index >= size || array->is_read_only())) {
+#ifdef DEBUG_ENABLED
+					if (array->is_read_only()) {
+						err_text = "Invalid assignment on read-only value (on base: '" + _get_var_type(dst) + "').";
+					} else {
+						err_text = "Out of bounds set index '" + itos(*VariantInternal::get_int(index)) + "' (on base: '" + _get_var_type(dst) + "')";
+					}
+					OPCODE_BREAK;
+#endif
+				} else {
+					(*array)[int_index] = *value;
+				}
+				ip += 4;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_GET_KEYED) {
 				CHECK_SPACE(3);
 
@@ -1165,8 +1510,34 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_GET_INDEXED_TYPED_ARRAY) {
+				CHECK_SPACE(4);
+
+				GET_VARIANT_PTR(src, 0);
+				GET_VARIANT_PTR(index, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				const Array *array = VariantInternal::get_array((const Variant *)src);
+				int64_t int_index = *VariantInternal::get_int(index);
+				const int64_t size = array->size();
+				if (int_index < 0) {
+					int_index += size;
+				}
+
+				if (unlikely(int_index < 0 || int_index >= size)) {
+#ifdef DEBUG_ENABLED
+					err_text = "Out of bounds get index '" + itos(*VariantInternal::get_int(index)) + "' (on base: '" + _get_var_type(src) + "')";
+					OPCODE_BREAK;
+#endif
+				} else {
+					*dst = (*array)[int_index];
+				}
+				ip += 4;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(4);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1176,8 +1547,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _inline_caches_count);
+
 				bool valid;
-				dst->set_named(*index, *value, valid);
+				if (!_inline_cache_set(cache_index, dst, *index, *value, valid)) {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1198,7 +1574,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1218,7 +1594,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1228,22 +1604,30 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _inline_caches_count);
+
+				Variant ret;
+				if (_inline_cache_get(cache_index, src, *index, ret)) {
+					*dst = ret;
+				} else {
+					bool valid;
 #ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+					//allow better error message in cases where src and dst are the same stack position
+					ret = src->get_named(*index, valid);
 
 #else
-				*dst = src->get_named(*index, valid);
+					*dst = src->get_named(*index, valid);
 #endif
 #ifdef DEBUG_ENABLED
-				if (!valid) {
-					err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
-					OPCODE_BREAK;
-				}
-				*dst = ret;
+					if (!valid) {
+						err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
+						OPCODE_BREAK;
+					}
+					*dst = ret;
 #endif
-				ip += 4;
+				}
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1305,6 +1689,35 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#ifdef DEBUG_ENABLED
+#define OPCODE_GET_MEMBER_CALL_METHOD_BIND(m_call_op)                        \
+	OPCODE(OPCODE_GET_MEMBER_##m_call_op) {                                  \
+		CHECK_SPACE(3);                                                      \
+		GET_VARIANT_PTR(dst, 0);                                             \
+		int indexname = _code_ptr[ip + 2];                                   \
+		GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);     \
+		const StringName *index = &_global_names_ptr[indexname];             \
+		bool ok = ClassDB::get_property(p_instance->owner, *index, *dst);    \
+		if (!ok) {                                                           \
+			err_text = "Internal error getting property: " + String(*index); \
+			OPCODE_BREAK;                                                    \
+		}                                                                    \
+		ip += 3;                                                             \
+	}                                                                        \
+	OPCODE_CHAIN(OPCODE_##m_call_op)
+#else // !DEBUG_ENABLED
+#define OPCODE_GET_MEMBER_CALL_METHOD_BIND(m_call_op)                                         \
+	OPCODE(OPCODE_GET_MEMBER_##m_call_op) {                                                   \
+		GET_VARIANT_PTR(dst, 0);                                                              \
+		ClassDB::get_property(p_instance->owner, _global_names_ptr[_code_ptr[ip + 2]], *dst); \
+		ip += 3;                                                                              \
+	}                                                                                         \
+	OPCODE_CHAIN(OPCODE_##m_call_op)
+#endif // DEBUG_ENABLED
+
+			OPCODE_GET_MEMBER_CALL_METHOD_BIND(CALL_METHOD_BIND_VALIDATED_RETURN);
+			OPCODE_GET_MEMBER_CALL_METHOD_BIND(CALL_METHOD_BIND_VALIDATED_NO_RETURN);
+
 			OPCODE(OPCODE_SET_STATIC_VARIABLE) {
 				CHECK_SPACE(4);
 
@@ -1862,7 +2275,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1873,6 +2286,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+				int cache_index = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _inline_caches_count);
+
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
@@ -1891,7 +2307,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					if (!_inline_cache_call(cache_index, base, *methodname, (const Variant **)argptrs, argc, temp_ret, err)) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					}
 					*ret = temp_ret;
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
@@ -1920,7 +2338,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						}
 					}
 #endif
-				} else {
+				} else if (!_inline_cache_call(cache_index, base, *methodname, (const Variant **)argptrs, argc, temp_ret, err)) {
 					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
 				}
 #ifdef DEBUG_ENABLED
@@ -1971,7 +2389,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif // DEBUG_ENABLED
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
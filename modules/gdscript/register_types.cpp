@@ -32,7 +32,9 @@
 
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_aot.h"
 #include "gdscript_cache.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_tokenizer.h"
 #include "gdscript_tokenizer_buffer.h"
 #include "gdscript_utility_functions.h"
@@ -75,6 +77,10 @@ Ref<ResourceFormatLoaderGDScript> resource_loader_gd;
 Ref<ResourceFormatSaverGDScript> resource_saver_gd;
 GDScriptCache *gdscript_cache = nullptr;
 
+#ifdef DEBUG_ENABLED
+Ref<GDScriptSamplingProfiler> gdscript_sampling_profiler;
+#endif
+
 #ifdef TOOLS_ENABLED
 
 Ref<GDScriptEditorTranslationParserPlugin> gdscript_translation_parser_plugin;
@@ -85,7 +91,14 @@ class EditorExportGDScript : public EditorExportPlugin {
 	static constexpr int DEFAULT_SCRIPT_MODE = EditorExportPreset::MODE_SCRIPT_BINARY_TOKENS_COMPRESSED;
 	int script_mode = DEFAULT_SCRIPT_MODE;
 
+	String aot_path;
+	HashMap<uint64_t, GDScriptAOT::Translation> aot_functions;
+
 protected:
+	virtual void _get_export_options(const Ref<EditorExportPlatform> &p_export_platform, List<EditorExportPlatform::ExportOption> *r_options) const override {
+		r_options->push_back(EditorExportPlatform::ExportOption(PropertyInfo(Variant::STRING, "gdscript/aot_cpp_path", PROPERTY_HINT_GLOBAL_SAVE_FILE, "*.cpp"), ""));
+	}
+
 	virtual void _export_begin(const HashSet<String> &p_features, bool p_debug, const String &p_path, int p_flags) override {
 		script_mode = DEFAULT_SCRIPT_MODE;
 
@@ -93,10 +106,24 @@ protected:
 		if (preset.is_valid()) {
 			script_mode = preset->get_script_export_mode();
 		}
+
+		aot_path = get_option("gdscript/aot_cpp_path");
+		aot_functions.clear();
 	}
 
 	virtual void _export_file(const String &p_path, const String &p_type, const HashSet<String> &p_features) override {
-		if (p_path.get_extension() != "gd" || script_mode == EditorExportPreset::MODE_SCRIPT_TEXT) {
+		if (p_path.get_extension() != "gd") {
+			return;
+		}
+
+		if (!aot_path.is_empty()) {
+			Ref<GDScript> script = ResourceLoader::load(p_path);
+			if (script.is_valid() && script->is_valid()) {
+				GDScriptAOT::translate_script(script.ptr(), aot_functions);
+			}
+		}
+
+		if (script_mode == EditorExportPreset::MODE_SCRIPT_TEXT) {
 			return;
 		}
 
@@ -116,6 +143,18 @@ protected:
 		add_file(p_path.get_basename() + ".gdc", file, true);
 	}
 
+	virtual void _export_end() override {
+		if (aot_path.is_empty()) {
+			return;
+		}
+
+		// Only usable once compiled into an export template, see the `gdscript_aot_source` build option.
+		Ref<FileAccess> f = FileAccess::open(aot_path, FileAccess::WRITE);
+		ERR_FAIL_COND_MSG(f.is_null(), "Cannot write the GDScript C++ translation to: " + aot_path);
+		f->store_string(GDScriptAOT::generate_source(aot_functions));
+		aot_functions.clear();
+	}
+
 public:
 	virtual String get_name() const override { return "GDScript"; }
 };
@@ -157,6 +196,15 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 		gdscript_cache = memnew(GDScriptCache);
 
 		GDScriptUtilityFunctions::register_functions();
+
+#ifdef DEBUG_ENABLED
+		gdscript_sampling_profiler.instantiate();
+		gdscript_sampling_profiler->bind("gdscript_sampler");
+#endif
+
+#ifdef GDSCRIPT_AOT_ENABLED
+		register_gdscript_aot_functions();
+#endif
 	}
 
 #ifdef TOOLS_ENABLED
@@ -178,6 +226,11 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 
 void uninitialize_gdscript_module(ModuleInitializationLevel p_level) {
 	if (p_level == MODULE_INITIALIZATION_LEVEL_SERVERS) {
+#ifdef DEBUG_ENABLED
+		// Stops the sampling thread before the language goes away.
+		gdscript_sampling_profiler.unref();
+#endif
+
 		ScriptServer::unregister_language(script_language_gd);
 
 		if (gdscript_cache) {
@@ -196,6 +249,7 @@ void uninitialize_gdscript_module(ModuleInitializationLevel p_level) {
 
 		GDScriptParser::cleanup();
 		GDScriptUtilityFunctions::unregister_functions();
+		GDScriptAOT::clear();
 	}
 
 #ifdef TOOLS_ENABLED
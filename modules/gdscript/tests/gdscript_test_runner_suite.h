@@ -33,6 +33,11 @@
 
 #include "gdscript_test_runner.h"
 
+#include "../gdscript_aot.h"
+#include "../gdscript_byte_codegen.h"
+#include "../gdscript_parser.h"
+#include "../gdscript_sampling_profiler.h"
+
 #include "tests/test_macros.h"
 
 namespace GDScriptTests {
@@ -70,8 +75,272 @@ func _init():
 	ref_counted->set_script(gdscript);
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
+
+// Compiles the source with or without superinstructions and returns what its `run()` returns.
+static Variant run_test_script(const String &p_source, bool p_superinstructions) {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(p_source);
+	GDScriptByteCodeGenerator::superinstructions_enabled = p_superinstructions;
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	GDScriptByteCodeGenerator::superinstructions_enabled = true;
+	CHECK_MESSAGE(error == OK, "The script should parse successfully.");
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+	return ref_counted->call("run");
+}
+
+TEST_CASE("[Modules][GDScript] Superinstructions keep results") {
+	// Typed arithmetic, compound assignments and compare-and-jump, the pairs fused by the codegen.
+	const String source = R"(
+extends RefCounted
+
+var wraps := 0
+
+func run() -> int:
+	var total := 0
+	var i := 0
+	while i < 300000:
+		total += i * 3
+		if total > 1000000:
+			total -= 1000000
+			wraps += 1
+		i += 1
+	return total + wraps
+)";
+
+	int64_t expected_total = 0;
+	int64_t expected_wraps = 0;
+	for (int64_t i = 0; i < 300000; i++) {
+		expected_total += i * 3;
+		if (expected_total > 1000000) {
+			expected_total -= 1000000;
+			expected_wraps++;
+		}
+	}
+
+	CHECK_MESSAGE(int64_t(run_test_script(source, false)) == expected_total + expected_wraps, "The unfused loop should compute the right result.");
+	CHECK_MESSAGE(int64_t(run_test_script(source, true)) == expected_total + expected_wraps, "Superinstructions should not change the result.");
+}
+
+TEST_CASE("[Modules][GDScript] Typed array indexing keeps results") {
+	// The same loop over a typed and an untyped array; only the typed one uses the typed array opcodes.
+	const String source = R"(
+extends RefCounted
+
+func run() -> Array:
+	var values: %s = []
+	values.resize(1000)
+	values.fill(0)
+	var total := 0
+	for j in 100:
+		for i in 1000:
+			values[i] = i + j
+			total += values[i]
+	values[-2] = -5
+	return [total, values[-1], values[998], values.size()]
+)";
+
+	// Sum over j < 100 and i < 1000 of i + j.
+	Array expected;
+	expected.push_back(100 * 499500 + 1000 * 4950);
+	expected.push_back(999 + 99);
+	expected.push_back(-5);
+	expected.push_back(1000);
+	CHECK(run_test_script(vformat(source, "Array"), true) == Variant(expected));
+	CHECK_MESSAGE(run_test_script(vformat(source, "Array[int]"), true) == Variant(expected), "Typed array opcodes should not change the result, negative indices included.");
+}
+
+static void aot_test_stub(GDScriptFunction::AOTFrame &p_frame) {}
+
+static Ref<GDScript> compile_aot_script(const String &p_source, bool p_superinstructions) {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(p_source);
+	GDScriptByteCodeGenerator::superinstructions_enabled = p_superinstructions;
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	GDScriptByteCodeGenerator::superinstructions_enabled = true;
+	CHECK_MESSAGE(error == OK, "The script should parse successfully.");
+	return gdscript;
+}
+
+TEST_CASE("[Modules][GDScript] Ahead-of-time translation to C++") {
+	const String source = R"(
+extends RefCounted
+
+func sum_squares(n: int, offset: int = 1) -> int:
+	var total := 0
+	for i in n:
+		if i % 2 == 0:
+			total += i * i
+	return total + offset
+
+func untyped(a, b):
+	return a.foo(b)
+)";
+
+	Ref<GDScript> fused = compile_aot_script(source, true);
+	Ref<GDScript> unfused = compile_aot_script(source, false);
+	const GDScriptFunction *typed_function = fused->get_member_functions()["sum_squares"];
+	const GDScriptFunction *untyped_function = fused->get_member_functions()["untyped"];
+
+	const uint64_t hash = GDScriptAOT::hash_function(typed_function);
+	CHECK_MESSAGE(hash != 0, "Fully typed functions should be translatable.");
+	CHECK_MESSAGE(hash == GDScriptAOT::hash_function(unfused->get_member_functions()["sum_squares"]), "Superinstructions should not change the hash.");
+	CHECK_MESSAGE(GDScriptAOT::hash_function(untyped_function) == 0, "Dynamically typed functions should be left to the VM.");
+
+	GDScriptAOT::Translation translation;
+	uint64_t translated_hash = 0;
+	CHECK(GDScriptAOT::translate_function(typed_function, translation, &translated_hash) == OK);
+	CHECK(translated_hash == hash);
+	CHECK(translation.code.contains(GDScriptAOT::get_function_symbol(hash) + "(GDScriptFunction::AOTFrame &p_frame)"));
+	CHECK(translation.code.contains("p_frame.operator_funcs["));
+	CHECK(translation.code.contains("switch (p_frame.default_argument)"));
+	CHECK(translation.code_size > 0);
+	CHECK(GDScriptAOT::translate_function(untyped_function, translation) == ERR_UNAVAILABLE);
+
+	HashMap<uint64_t, GDScriptAOT::Translation> functions;
+	GDScriptAOT::translate_script(fused.ptr(), functions);
+	CHECK(functions.has(hash));
+	const String generated = GDScriptAOT::generate_source(functions);
+	CHECK(generated.contains("void register_gdscript_aot_functions() {"));
+	CHECK(generated.contains(vformat("GDScriptAOT::register_function(0x%sULL, %d, %d, &%s);", String::num_uint64(hash, 16), translation.code_size, translation.constant_count, GDScriptAOT::get_function_symbol(hash))));
+
+	// A registration under the same hash but for different bytecode must not be picked up.
+	GDScriptAOT::register_function(hash, translation.code_size + 1, translation.constant_count, &aot_test_stub);
+	CHECK(GDScriptAOT::find_function(typed_function) == nullptr);
+	GDScriptAOT::register_function(hash, translation.code_size, translation.constant_count, &aot_test_stub);
+	CHECK(GDScriptAOT::find_function(typed_function) == &aot_test_stub);
+	GDScriptAOT::clear();
+}
 #endif // TOOLS_ENABLED
 
+TEST_CASE("[Modules][GDScript] Parser collects dependencies to prefetch") {
+	GDScriptParser parser;
+	const Error error = parser.parse(R"(
+extends "base.gd"
+
+const Other = preload("res://other.gd")
+const Icon = preload("res://icon" + ".png")
+
+var node: MyNode
+var items: Array[MyItem] = []
+
+func run(value: int) -> MyResult:
+	return null
+)",
+			"res://dir/script.gd", false);
+	CHECK(error == OK);
+
+	const HashSet<String> &paths = parser.get_prefetch_paths();
+	CHECK(paths.size() == 2);
+	CHECK(paths.has("base.gd"));
+	CHECK(paths.has("res://other.gd"));
+	CHECK_MESSAGE(!paths.has("res://icon.png"), "Only literal preload paths are known before analysis.");
+
+	const HashSet<StringName> &class_names = parser.get_prefetch_class_names();
+	CHECK(class_names.has("MyNode"));
+	CHECK(class_names.has("Array"));
+	CHECK(class_names.has("MyItem"));
+	CHECK(class_names.has("int"));
+	CHECK(class_names.has("MyResult"));
+}
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[Modules][GDScript] Sampling profiler folds call stacks") {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+func outer():
+	inner()
+
+func inner():
+	pass
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(error == OK, "The script should parse successfully.");
+
+	const GDScriptFunction *outer = gdscript->get_member_functions()["outer"];
+	const GDScriptFunction *inner = gdscript->get_member_functions()["inner"];
+	const GDScriptFunction *stack[] = { outer, inner };
+	int not_a_function = 0;
+	const GDScriptFunction *stale_stack[] = { outer, reinterpret_cast<const GDScriptFunction *>(&not_a_function) };
+
+	Ref<GDScriptSamplingProfiler> profiler;
+	profiler.instantiate();
+	profiler->add_sample(Thread::get_main_id(), stack, 2);
+	profiler->add_sample(Thread::get_main_id(), stack, 2);
+	profiler->add_sample(Thread::get_main_id(), stack, 1);
+	profiler->add_sample(Thread::get_main_id(), stale_stack, 2);
+
+	Array folded;
+	profiler->take_folded_stacks(folded);
+	REQUIRE_MESSAGE(folded.size() == 6, "Stacks with a freed function should be dropped.");
+
+	HashMap<String, int> counts;
+	for (int i = 0; i < folded.size(); i += 3) {
+		CHECK(uint64_t(folded[i]) == Thread::get_main_id());
+		counts[folded[i + 1]] = folded[i + 2];
+	}
+	// Signatures are "path::line::name", the script has no path.
+	CHECK(counts["::4::outer;::7::inner"] == 2);
+	CHECK(counts["::4::outer"] == 1);
+
+	folded.clear();
+	profiler->take_folded_stacks(folded);
+	CHECK_MESSAGE(folded.is_empty(), "Samples should only be taken once.");
+}
+#endif // DEBUG_ENABLED
+
+TEST_CASE("[Modules][GDScript] Property handles access script members") {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+var untyped = 1
+var typed: float = 1.0
+var with_setter := 0:
+	set(value):
+		with_setter = value * 2
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+
+	bool valid = false;
+	PropertyHandle untyped("untyped");
+	ref_counted->set_by_handle(untyped, 5, &valid);
+	CHECK(valid);
+	CHECK(untyped.kind == PropertyHandle::KIND_SCRIPT_MEMBER);
+	CHECK(ref_counted->get("untyped") == Variant(5));
+	// A value of another type goes through the regular path.
+	ref_counted->set_by_handle(untyped, "text", &valid);
+	CHECK(valid);
+	CHECK(ref_counted->get_by_handle(untyped) == Variant("text"));
+
+	PropertyHandle typed("typed");
+	ref_counted->set_by_handle(typed, 2, &valid);
+	CHECK(valid);
+	CHECK(ref_counted->get_by_handle(typed).get_type() == Variant::FLOAT);
+	CHECK(ref_counted->get_by_handle(typed) == Variant(2.0));
+
+	PropertyHandle with_setter("with_setter");
+	ref_counted->set_by_handle(with_setter, 3, &valid);
+	CHECK(valid);
+	CHECK(with_setter.kind == PropertyHandle::KIND_GENERIC);
+	CHECK(ref_counted->get_by_handle(with_setter) == Variant(6));
+}
+
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
 
@@ -0,0 +1,4 @@
+func test():
+	var ints: Array[int] = [1, 2, 3]
+	var index := 3
+	ints[index] = 4
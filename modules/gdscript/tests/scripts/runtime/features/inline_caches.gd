@@ -0,0 +1,79 @@
+# Untyped property access and calls go through per-instruction inline caches.
+# Every receiver shape must still resolve the same way as the uncached path.
+
+class Plain:
+	var value = 1
+	var typed: float = 0.5
+
+class WithGetter:
+	var value = 1:
+		get:
+			return value * 10
+
+class WithSetter:
+	var value = 1:
+		set(v):
+			value = v * 10
+
+class WithHook:
+	func _get(property):
+		if property == &"value":
+			return "from _get"
+		return null
+
+class Overrides extends RefCounted:
+	@warning_ignore("native_method_override")
+	func get_class():
+		return "Overrides"
+
+func read_value(obj):
+	return obj.value
+
+func write_value(obj, v):
+	obj.value = v
+
+func write_typed(obj, v):
+	obj.typed = v
+
+func call_get_class(obj):
+	return obj.get_class()
+
+func test():
+	var receivers = [Plain.new(), WithGetter.new(), WithHook.new(), Plain.new()]
+	for _i in 3:
+		for obj in receivers:
+			print(read_value(obj))
+
+	var plain = Plain.new()
+	var with_setter = WithSetter.new()
+	for i in 2:
+		write_value(plain, i + 2)
+		write_value(with_setter, i + 2)
+	print(plain.value)
+	print(with_setter.value)
+
+	# Assigning an int to a float member needs a conversion.
+	write_typed(plain, 0.25)
+	write_typed(plain, 3)
+	print(plain.typed)
+	print(typeof(plain.typed) == TYPE_FLOAT)
+
+	# Native properties, including indexed ones.
+	var box = StyleBoxFlat.new()
+	for i in 2:
+		box.corner_radius_top_left = 4 + i
+		box.bg_color = Color.RED
+	print(box.corner_radius_top_left)
+	print(box.get_corner_radius(CORNER_TOP_LEFT))
+	var node = Node.new()
+	for i in 2:
+		node.name = "Cached%d" % i
+		print(node.name)
+	node.free()
+
+	# Native method calls, with and without a script override.
+	var ref = RefCounted.new()
+	var overrides = Overrides.new()
+	for _i in 2:
+		print(call_get_class(ref))
+		print(call_get_class(overrides))
@@ -0,0 +1,46 @@
+# Instruction pairs fused into superinstructions must behave like the separate instructions.
+
+var member := 0
+
+func sum_doubled_below(limit: int) -> int:
+	var sum := 0
+	var i := 0
+	while i < limit:
+		sum += i * 2
+		i += 1
+	return sum
+
+func test():
+	print(sum_doubled_below(10))
+
+	var a := 3
+	var b := 4
+	if a < b:
+		print("less")
+	if not (a > b):
+		print("not greater")
+	if a == b or b > 3:
+		print("either")
+
+	var x := 1
+	x += a * b
+	print(x)
+	member += x
+	member *= 2
+	print(member)
+
+	var f := 1.5
+	f = f * 2.0 + 0.5
+	print(f)
+
+	var v := Vector2(1, 2)
+	v = v * 2.0
+	print(v)
+
+	# Jumps landing on the second instruction of a pair.
+	var odd_sum := 0
+	for j in 5:
+		if j % 2 == 0:
+			continue
+		odd_sum += j
+	print(odd_sum)
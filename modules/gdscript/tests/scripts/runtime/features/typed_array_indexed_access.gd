@@ -0,0 +1,31 @@
+# Indexing typed arrays of built-in types uses dedicated opcodes, which must behave like the generic ones.
+
+func test():
+	var ints: Array[int] = [1, 2, 3]
+	ints[0] = 10
+	ints[-1] = ints[1] * 5
+	print(ints)
+	print(ints[-2])
+	print(ints.get_typed_builtin() == TYPE_INT)
+
+	var floats: Array[float] = [0.5, 1.5]
+	var value := floats[0] + floats[1]
+	floats[1] = value
+	print(floats)
+
+	var vectors: Array[Vector3] = [Vector3.ZERO, Vector3.ONE]
+	vectors[0] = vectors[1] * 2.0
+	print(vectors[0])
+
+	var names: Array[String] = ["a", "b"]
+	names[1] = names[0] + "c"
+	print(names)
+
+	var total := 0
+	for i in ints.size():
+		total += ints[i]
+	print(total)
+
+	var copy := ints
+	copy[1] = 0
+	print(ints[1])
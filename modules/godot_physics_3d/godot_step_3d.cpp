@@ -112,7 +112,7 @@ void GodotStep3D::_populate_island_soft_body(GodotSoftBody3D *p_soft_body, Local
 	}
 }
 
-void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
+void GodotStep3D::_setup_constraint(uint32_t p_constraint_index) {
 	GodotConstraint3D *constraint = all_constraints[p_constraint_index];
 	constraint->setup(delta);
 }
@@ -130,7 +130,7 @@ void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constrai
 	p_constraint_island.resize(valid_constraint_count);
 }
 
-void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
+void GodotStep3D::_solve_island(uint32_t p_island_index) {
 	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
 
 	int current_priority = 1;
@@ -344,8 +344,8 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	WorkerThreadPool::get_singleton()->parallel_for(
+			0, total_constraint_count, 0, [this](uint32_t p_index) { _setup_constraint(p_index); }, SNAME("Physics3DConstraintSetup"));
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
@@ -364,8 +364,9 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	// WARNING: `_solve_island` modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
-	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	// Islands vary a lot in size, so let them be balanced one by one.
+	WorkerThreadPool::get_singleton()->parallel_for(
+			0, island_count, 1, [this](uint32_t p_index) { _solve_island(p_index); }, SNAME("Physics3DConstraintSolveIslands"));
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
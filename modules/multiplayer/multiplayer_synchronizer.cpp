@@ -110,6 +110,7 @@ void MultiplayerSynchronizer::reset() {
 	last_watch_usec = 0;
 	sync_started = false;
 	watchers.clear();
+	sync_property_handles.clear();
 }
 
 uint32_t MultiplayerSynchronizer::get_net_id() const {
@@ -153,7 +154,7 @@ PackedStringArray MultiplayerSynchronizer::get_configuration_warnings() const {
 	return warnings;
 }
 
-Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs) {
+Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs, PropertyHandle *p_handles) {
 	ERR_FAIL_NULL_V(p_obj, ERR_INVALID_PARAMETER);
 	r_variant.resize(p_properties.size());
 	r_variant_ptrs.resize(r_variant.size());
@@ -162,7 +163,11 @@ Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Obj
 		bool valid = false;
 		const Object *obj = _get_prop_target(p_obj, prop);
 		ERR_FAIL_NULL_V(obj, FAILED);
-		r_variant.write[i] = obj->get_indexed(prop.get_subnames(), &valid);
+		if (p_handles) {
+			r_variant.write[i] = obj->get_indexed(p_handles[i], prop.get_subnames(), &valid);
+		} else {
+			r_variant.write[i] = obj->get_indexed(prop.get_subnames(), &valid);
+		}
 		r_variant_ptrs.write[i] = &r_variant[i];
 		ERR_FAIL_COND_V_MSG(!valid, ERR_INVALID_DATA, vformat("Property '%s' not found.", prop));
 		i++;
@@ -170,18 +175,29 @@ Error MultiplayerSynchronizer::get_state(const List<NodePath> &p_properties, Obj
 	return OK;
 }
 
-Error MultiplayerSynchronizer::set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state) {
+Error MultiplayerSynchronizer::set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state, PropertyHandle *p_handles) {
 	ERR_FAIL_NULL_V(p_obj, ERR_INVALID_PARAMETER);
 	int i = 0;
 	for (const NodePath &prop : p_properties) {
 		Object *obj = _get_prop_target(p_obj, prop);
 		ERR_FAIL_NULL_V(obj, FAILED);
-		obj->set_indexed(prop.get_subnames(), p_state[i]);
+		if (p_handles) {
+			obj->set_indexed(p_handles[i], prop.get_subnames(), p_state[i]);
+		} else {
+			obj->set_indexed(prop.get_subnames(), p_state[i]);
+		}
 		i += 1;
 	}
 	return OK;
 }
 
+PropertyHandle *MultiplayerSynchronizer::get_sync_property_handles(int p_count) {
+	if (sync_property_handles.size() != p_count) {
+		sync_property_handles.resize(p_count);
+	}
+	return sync_property_handles.ptrw();
+}
+
 bool MultiplayerSynchronizer::is_visibility_public() const {
 	return peer_visibility.has(0);
 }
@@ -388,9 +404,9 @@ Error MultiplayerSynchronizer::_watch_changes(uint64_t p_usec) {
 		bool valid = false;
 		const Object *obj = _get_prop_target(node, prop);
 		ERR_CONTINUE_MSG(!obj, vformat("Node not found for property '%s'.", prop));
-		Variant v = obj->get_indexed(prop.get_subnames(), &valid);
-		ERR_CONTINUE_MSG(!valid, vformat("Property '%s' not found.", prop));
 		Watcher &w = ptr[idx];
+		Variant v = obj->get_indexed(w.handle, prop.get_subnames(), &valid);
+		ERR_CONTINUE_MSG(!valid, vformat("Property '%s' not found.", prop));
 		if (w.prop != prop) {
 			w.prop = prop;
 			w.value = v.duplicate(true);
@@ -48,6 +48,7 @@ public:
 private:
 	struct Watcher {
 		NodePath prop;
+		PropertyHandle handle;
 		uint64_t last_change_usec = 0;
 		Variant value;
 	};
@@ -60,6 +61,7 @@ private:
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
 	Vector<Watcher> watchers;
+	Vector<PropertyHandle> sync_property_handles;
 	uint64_t last_watch_usec = 0;
 
 	ObjectID root_node_cache;
@@ -79,8 +81,10 @@ protected:
 	void _notification(int p_what);
 
 public:
-	static Error get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs);
-	static Error set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state);
+	// `p_handles`, if given, must hold one handle per property and is kept between calls with the same properties.
+	static Error get_state(const List<NodePath> &p_properties, Object *p_obj, Vector<Variant> &r_variant, Vector<const Variant *> &r_variant_ptrs, PropertyHandle *p_handles = nullptr);
+	static Error set_state(const List<NodePath> &p_properties, Object *p_obj, const Vector<Variant> &p_state, PropertyHandle *p_handles = nullptr);
+	PropertyHandle *get_sync_property_handles(int p_count);
 
 	void reset();
 	Node *get_root_node();
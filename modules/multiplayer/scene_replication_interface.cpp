@@ -826,7 +826,7 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 		Vector<Variant> vars;
 		Vector<const Variant *> varp;
 		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
-		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
+		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp, sync->get_sync_property_handles(props.size()));
 		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
 		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
@@ -890,7 +890,7 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 		int consumed;
 		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
 		ERR_FAIL_COND_V(err, err);
-		err = MultiplayerSynchronizer::set_state(props, node, vars);
+		err = MultiplayerSynchronizer::set_state(props, node, vars, sync->get_sync_property_handles(props.size()));
 		ERR_FAIL_COND_V(err, err);
 		ofs += size;
 		sync->emit_signal(SNAME("synchronized"));
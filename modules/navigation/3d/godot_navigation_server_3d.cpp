@@ -30,6 +30,7 @@
 
 #include "godot_navigation_server_3d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 #include "scene/main/node.h"
 
@@ -1313,6 +1314,10 @@ void GodotNavigationServer3D::sync() {
 #endif // _3D_DISABLED
 }
 
+void GodotNavigationServer3D::_sync_map(void *p_map) {
+	static_cast<NavMap *>(p_map)->sync();
+}
+
 void GodotNavigationServer3D::process(real_t p_delta_time) {
 	flush_queries();
 
@@ -1333,9 +1338,23 @@ void GodotNavigationServer3D::process(real_t p_delta_time) {
 	// In c++ we can't be sure that this is performed in the main thread
 	// even with mutable functions.
 	MutexLock lock(operations_mutex);
+
+	if (active_maps.size() > 1) {
+		// Maps don't share any state, so they can all sync and step at the same time.
+		WorkerThreadPool::TaskGraph map_graph;
+		for (NavMap *map : active_maps) {
+			WorkerThreadPool::TaskGraph::NodeID sync_task = map_graph.add_native_task(&_sync_map, map);
+			WorkerThreadPool::TaskGraph::NodeID step_task = map_graph.add_template_task(map, &NavMap::step, p_delta_time);
+			map_graph.add_dependency(sync_task, step_task);
+		}
+		WorkerThreadPool::TaskID graph_task = WorkerThreadPool::get_singleton()->add_task_graph(&map_graph, true, SNAME("NavigationMapsIteration"));
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(graph_task);
+	} else if (active_maps.size() == 1) {
+		active_maps[0]->sync();
+		active_maps[0]->step(p_delta_time);
+	}
+
 	for (uint32_t i(0); i < active_maps.size(); i++) {
-		active_maps[i]->sync();
-		active_maps[i]->step(p_delta_time);
 		active_maps[i]->dispatch_callbacks();
 
 		_new_pm_region_count += active_maps[i]->get_pm_region_count();
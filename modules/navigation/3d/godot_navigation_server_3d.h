@@ -293,6 +293,8 @@ public:
 	int get_process_info(ProcessInfo p_info) const override;
 
 private:
+	static void _sync_map(void *p_map);
+
 	void internal_free_agent(RID p_object);
 	void internal_free_obstacle(RID p_object);
 };
@@ -206,7 +206,8 @@ Vector<Vector3> NavMeshQueries3D::polygons_get_path(const LocalVector<gd::Polygo
 	}
 
 	// List of all reachable navigation polys.
-	LocalVector<gd::NavigationPoly> navigation_polys;
+	// Query scratch data lives in the frame arena, it is all released when the query returns.
+	FrameLocalVector<gd::NavigationPoly> navigation_polys;
 	navigation_polys.resize(p_polygons.size() + p_link_polygons_size);
 
 	// Initialize the matching navigation polygon.
@@ -217,7 +218,7 @@ Vector<Vector3> NavMeshQueries3D::polygons_get_path(const LocalVector<gd::Polygo
 	begin_navigation_poly.back_navigation_edge_pathway_end = begin_point;
 
 	// Heap of polygons to travel next.
-	gd::Heap<gd::NavigationPoly *, gd::NavPolyTravelCostGreaterThan, gd::NavPolyHeapIndexer>
+	gd::Heap<gd::NavigationPoly *, gd::NavPolyTravelCostGreaterThan, gd::NavPolyHeapIndexer, FrameArena>
 			traversable_polys;
 	traversable_polys.reserve(p_polygons.size() * 0.25);
 
@@ -678,7 +679,7 @@ RID NavMeshQueries3D::polygons_get_closest_point_owner(const LocalVector<gd::Pol
 	return cp.owner;
 }
 
-void NavMeshQueries3D::clip_path(const LocalVector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners, const Vector3 &p_map_up) {
+void NavMeshQueries3D::clip_path(const FrameLocalVector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners, const Vector3 &p_map_up) {
 	Vector3 from = path[path.size() - 1];
 
 	if (from.is_equal_approx(p_to_point)) {
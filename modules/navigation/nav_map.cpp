@@ -830,8 +830,9 @@ void NavMap::step(real_t p_deltatime) {
 
 	if (active_2d_avoidance_agents.size() > 0) {
 		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
-			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			NavAgent **agents = active_2d_avoidance_agents.ptr();
+			WorkerThreadPool::get_singleton()->parallel_for(
+					0, active_2d_avoidance_agents.size(), 0, [this, agents](uint32_t p_index) { compute_single_avoidance_step_2d(p_index, agents); }, SNAME("RVOAvoidanceAgents2D"));
 		} else {
 			for (NavAgent *agent : active_2d_avoidance_agents) {
 				agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
@@ -844,8 +845,9 @@ void NavMap::step(real_t p_deltatime) {
 
 	if (active_3d_avoidance_agents.size() > 0) {
 		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_avoidance_step_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents3D"));
-			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			NavAgent **agents = active_3d_avoidance_agents.ptr();
+			WorkerThreadPool::get_singleton()->parallel_for(
+					0, active_3d_avoidance_agents.size(), 0, [this, agents](uint32_t p_index) { compute_single_avoidance_step_3d(p_index, agents); }, SNAME("RVOAvoidanceAgents3D"));
 		} else {
 			for (NavAgent *agent : active_3d_avoidance_agents) {
 				agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
@@ -183,9 +183,9 @@ struct NoopIndexer {
 /**
  * A max-heap implementation that notifies of element index changes.
  */
-template <typename T, typename LessThan = Comparator<T>, typename Indexer = NoopIndexer<T>>
+template <typename T, typename LessThan = Comparator<T>, typename Indexer = NoopIndexer<T>, typename A = DefaultAllocator>
 class Heap {
-	LocalVector<T> _buffer;
+	LocalVector<T, uint32_t, false, false, A> _buffer;
 
 	LessThan _less_than;
 	Indexer _indexer;
@@ -82,7 +82,6 @@ void RaycastOcclusionCull::RaycastHZBuffer::resize(const Size2i &p_size) {
 
 void RaycastOcclusionCull::RaycastHZBuffer::update_camera_rays(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
 	CameraRayThreadData td;
-	td.thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
 
 	td.z_near = p_cam_projection.get_z_near();
 	td.z_far = p_cam_projection.get_z_far() * 1.05f;
@@ -101,16 +100,8 @@ void RaycastOcclusionCull::RaycastHZBuffer::update_camera_rays(const Transform3D
 
 	debug_tex_range = td.z_far;
 
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RaycastHZBuffer::_camera_rays_threaded, &td, td.thread_count, -1, true, SNAME("RaycastOcclusionCullUpdateCamera"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
-}
-
-void RaycastOcclusionCull::RaycastHZBuffer::_camera_rays_threaded(uint32_t p_thread, const CameraRayThreadData *p_data) {
-	uint32_t total_tiles = camera_rays_tile_count;
-	uint32_t total_threads = p_data->thread_count;
-	uint32_t from = p_thread * total_tiles / total_threads;
-	uint32_t to = (p_thread + 1 == total_threads) ? total_tiles : ((p_thread + 1) * total_tiles / total_threads);
-	_generate_camera_rays(p_data, from, to);
+	WorkerThreadPool::get_singleton()->parallel_for_range(
+			0, camera_rays_tile_count, 0, [this, &td](uint32_t p_from, uint32_t p_to) { _generate_camera_rays(&td, p_from, p_to); }, SNAME("RaycastOcclusionCullUpdateCamera"));
 }
 
 void RaycastOcclusionCull::RaycastHZBuffer::_generate_camera_rays(const CameraRayThreadData *p_data, int p_from, int p_to) {
@@ -314,10 +305,6 @@ void RaycastOcclusionCull::scenario_remove_instance(RID p_scenario, RID p_instan
 	}
 }
 
-void RaycastOcclusionCull::Scenario::_update_dirty_instance_thread(int p_idx, RID *p_instances) {
-	_update_dirty_instance(p_idx, p_instances);
-}
-
 void RaycastOcclusionCull::Scenario::_update_dirty_instance(int p_idx, RID *p_instances) {
 	OccluderInstance *occ_inst = instances.getptr(p_instances[p_idx]);
 
@@ -340,14 +327,10 @@ void RaycastOcclusionCull::Scenario::_update_dirty_instance(int p_idx, RID *p_in
 	Vector3 *write_ptr = occ_inst->xformed_vertices.ptr();
 
 	if (vertices_size > 1024) {
-		TransformThreadData td;
-		td.xform = occ_inst->xform;
-		td.read = read_ptr;
-		td.write = write_ptr;
-		td.vertex_count = vertices_size;
-		td.thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
-		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Scenario::_transform_vertices_thread, &td, td.thread_count, -1, true, SNAME("RaycastOcclusionCull"));
-		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		// May be nested in the per-instance parallel loop, which parallel_for() handles without blocking a worker.
+		const Transform3D &xform = occ_inst->xform;
+		WorkerThreadPool::get_singleton()->parallel_for_range(
+				0, vertices_size, 0, [this, read_ptr, write_ptr, &xform](uint32_t p_from, uint32_t p_to) { _transform_vertices_range(read_ptr, write_ptr, xform, p_from, p_to); }, SNAME("RaycastOcclusionCull"));
 
 	} else {
 		_transform_vertices_range(read_ptr, write_ptr, occ_inst->xform, 0, vertices_size);
@@ -357,14 +340,6 @@ void RaycastOcclusionCull::Scenario::_update_dirty_instance(int p_idx, RID *p_in
 	memcpy(occ_inst->indices.ptr(), occ->indices.ptr(), occ->indices.size() * sizeof(int32_t));
 }
 
-void RaycastOcclusionCull::Scenario::_transform_vertices_thread(uint32_t p_thread, TransformThreadData *p_data) {
-	uint32_t vertex_total = p_data->vertex_count;
-	uint32_t total_threads = p_data->thread_count;
-	uint32_t from = p_thread * vertex_total / total_threads;
-	uint32_t to = (p_thread + 1 == total_threads) ? vertex_total : ((p_thread + 1) * vertex_total / total_threads);
-	_transform_vertices_range(p_data->read, p_data->write, p_data->xform, from, to);
-}
-
 void RaycastOcclusionCull::Scenario::_transform_vertices_range(const Vector3 *p_read, Vector3 *p_write, const Transform3D &p_xform, int p_from, int p_to) {
 	for (int i = p_from; i < p_to; i++) {
 		p_write[i] = p_xform.xform(p_read[i]);
@@ -421,8 +396,9 @@ void RaycastOcclusionCull::Scenario::update() {
 
 	if (dirty_instances_array.size() / WorkerThreadPool::get_singleton()->get_thread_count() > 128) {
 		// Lots of instances, use per-instance threading
-		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Scenario::_update_dirty_instance_thread, dirty_instances_array.ptr(), dirty_instances_array.size(), -1, true, SNAME("RaycastOcclusionCullUpdate"));
-		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		RID *dirty_instances_ptr = dirty_instances_array.ptr();
+		WorkerThreadPool::get_singleton()->parallel_for(
+				0, dirty_instances_array.size(), 1, [this, dirty_instances_ptr](uint32_t p_index) { _update_dirty_instance(p_index, dirty_instances_ptr); }, SNAME("RaycastOcclusionCullUpdate"));
 
 	} else {
 		// Few instances, use threading on the vertex transforms
@@ -494,8 +470,8 @@ void RaycastOcclusionCull::Scenario::raycast(CameraRayTile *r_rays, const uint32
 	td.rays = r_rays;
 	td.masks = p_valid_masks;
 
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Scenario::_raycast, &td, p_tile_count, -1, true, SNAME("RaycastOcclusionCullRaycast"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	WorkerThreadPool::get_singleton()->parallel_for(
+			0, p_tile_count, 0, [this, &td](uint32_t p_index) { _raycast(p_index, &td); }, SNAME("RaycastOcclusionCullRaycast"));
 }
 
 ////////////////////////////////////////////////////////
@@ -51,7 +51,6 @@ public:
 		Size2i tile_grid_size;
 
 		struct CameraRayThreadData {
-			int thread_count;
 			float z_near;
 			float z_far;
 			Vector3 camera_dir;
@@ -63,7 +62,6 @@ public:
 			Size2i buffer_size;
 		};
 
-		void _camera_rays_threaded(uint32_t p_thread, const CameraRayThreadData *p_data);
 		void _generate_camera_rays(const CameraRayThreadData *p_data, int p_from, int p_to);
 
 	public:
@@ -121,14 +119,6 @@ private:
 			const uint32_t *masks;
 		};
 
-		struct TransformThreadData {
-			uint32_t thread_count;
-			uint32_t vertex_count;
-			Transform3D xform;
-			const Vector3 *read;
-			Vector3 *write = nullptr;
-		};
-
 		Thread *commit_thread = nullptr;
 		bool commit_done = true;
 		bool dirty = false;
@@ -141,9 +131,7 @@ private:
 		LocalVector<RID> dirty_instances_array; // To iterate and split into threads
 		LocalVector<RID> removed_instances;
 
-		void _update_dirty_instance_thread(int p_idx, RID *p_instances);
 		void _update_dirty_instance(int p_idx, RID *p_instances);
-		void _transform_vertices_thread(uint32_t p_thread, TransformThreadData *p_data);
 		void _transform_vertices_range(const Vector3 *p_read, Vector3 *p_write, const Transform3D &p_xform, int p_from, int p_to);
 		static void _commit_scene(void *p_ud);
 		void free();
@@ -2049,6 +2049,39 @@ uint64_t OS_Windows::get_embedded_pck_offset() const {
 	return off;
 }
 
+const uint8_t *OS_Windows::map_file(const String &p_path, uint64_t &r_length) const {
+	HANDLE file = CreateFileW((LPCWSTR)p_path.utf16().get_data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return nullptr;
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+		CloseHandle(file);
+		return nullptr;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping) {
+		return nullptr;
+	}
+
+	void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping); // The view keeps the mapping referenced.
+	if (!data) {
+		return nullptr;
+	}
+
+	r_length = size.QuadPart;
+	return static_cast<const uint8_t *>(data);
+}
+
+void OS_Windows::unmap_file(const uint8_t *p_data, uint64_t p_length) const {
+	ERR_FAIL_NULL(p_data);
+	UnmapViewOfFile(p_data);
+}
+
 String OS_Windows::get_config_path() const {
 	if (has_environment("APPDATA")) {
 		return get_environment("APPDATA").replace("\\", "/");
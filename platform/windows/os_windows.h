@@ -220,6 +220,8 @@ public:
 	virtual String get_model_name() const override;
 
 	virtual uint64_t get_embedded_pck_offset() const override;
+	virtual const uint8_t *map_file(const String &p_path, uint64_t &r_length) const override;
+	virtual void unmap_file(const uint8_t *p_data, uint64_t p_length) const override;
 
 	virtual String get_config_path() const override;
 	virtual String get_data_path() const override;
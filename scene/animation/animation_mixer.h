@@ -227,6 +227,7 @@ protected:
 		Variant init_value;
 		Variant value;
 		Vector<StringName> subpath;
+		PropertyHandle property_handle;
 
 		// TODO: There are many boolean, can be packed into one integer.
 		bool is_init = false;
@@ -216,6 +216,7 @@ protected:
 private:
 	ObjectID target;
 	Vector<StringName> property;
+	PropertyHandle property_handle;
 	Variant initial_val;
 	Variant base_final_val;
 	Variant final_val;
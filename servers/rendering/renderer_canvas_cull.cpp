@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/math/geometry_2d.h"
 #include "core/math/transform_interpolator.h"
+#include "core/os/frame_arena.h"
 #include "renderer_viewport.h"
 #include "rendering_server_default.h"
 #include "rendering_server_globals.h"
@@ -361,6 +362,7 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 
 	int child_item_count = ci->child_items.size();
 	Item **child_items = ci->child_items.ptrw();
+	FrameLocalVector<Item *> ysort_children; // Can hold a whole subtree, too big for the stack.
 
 	if (ci->clip) {
 		if (p_canvas_clip != nullptr) {
@@ -394,7 +396,8 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			}
 
 			child_item_count = ci->ysort_children_count + 1;
-			child_items = (Item **)alloca(child_item_count * sizeof(Item *));
+			ysort_children.resize(child_item_count);
+			child_items = ysort_children.ptr();
 
 			ci->ysort_xform = Transform2D();
 			ci->ysort_modulate = Color(1, 1, 1, 1);
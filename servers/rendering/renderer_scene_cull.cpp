@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
 #include "rendering_light_culler.h"
 #include "rendering_server_constants.h"
@@ -2495,18 +2496,18 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					real_t radius = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
 
 					real_t z = i == 0 ? -1 : 1;
-					Vector<Plane> planes;
-					planes.resize(6);
-					planes.write[0] = light_transform.xform(Plane(Vector3(0, 0, z), radius));
-					planes.write[1] = light_transform.xform(Plane(Vector3(1, 0, z).normalized(), radius));
-					planes.write[2] = light_transform.xform(Plane(Vector3(-1, 0, z).normalized(), radius));
-					planes.write[3] = light_transform.xform(Plane(Vector3(0, 1, z).normalized(), radius));
-					planes.write[4] = light_transform.xform(Plane(Vector3(0, -1, z).normalized(), radius));
-					planes.write[5] = light_transform.xform(Plane(Vector3(0, 0, -z), 0));
+					const Plane planes[6] = {
+						light_transform.xform(Plane(Vector3(0, 0, z), radius)),
+						light_transform.xform(Plane(Vector3(1, 0, z).normalized(), radius)),
+						light_transform.xform(Plane(Vector3(-1, 0, z).normalized(), radius)),
+						light_transform.xform(Plane(Vector3(0, 1, z).normalized(), radius)),
+						light_transform.xform(Plane(Vector3(0, -1, z).normalized(), radius)),
+						light_transform.xform(Plane(Vector3(0, 0, -z), 0)),
+					};
 
 					instance_shadow_cull_result.clear();
 
-					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
+					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(planes, 6);
 
 					struct CullConvex {
 						PagedArray<Instance *> *result;
@@ -2520,7 +2521,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					CullConvex cull_convex;
 					cull_convex.result = &instance_shadow_cull_result;
 
-					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
+					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes, 6, points.ptr(), points.size(), cull_convex);
 
 					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
 
@@ -2812,14 +2813,6 @@ void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_bu
 #endif
 }
 
-void RendererSceneCull::_visibility_cull_threaded(uint32_t p_thread, VisibilityCullData *cull_data) {
-	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
-	uint32_t bin_from = p_thread * cull_data->cull_count / total_threads;
-	uint32_t bin_to = (p_thread + 1 == total_threads) ? cull_data->cull_count : ((p_thread + 1) * cull_data->cull_count / total_threads);
-
-	_visibility_cull(*cull_data, cull_data->cull_offset + bin_from, cull_data->cull_offset + bin_to);
-}
-
 void RendererSceneCull::_visibility_cull(const VisibilityCullData &cull_data, uint64_t p_from, uint64_t p_to) {
 	Scenario *scenario = cull_data.scenario;
 	for (unsigned int i = p_from; i < p_to; i++) {
@@ -2908,15 +2901,6 @@ bool RendererSceneCull::_visibility_parent_check(const CullData &p_cull_data, co
 	return ((parent_flags & InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK) == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE) || (parent_flags & InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN);
 }
 
-void RendererSceneCull::_scene_cull_threaded(uint32_t p_thread, CullData *cull_data) {
-	uint32_t cull_total = cull_data->scenario->instance_data.size();
-	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
-	uint32_t cull_from = p_thread * cull_total / total_threads;
-	uint32_t cull_to = (p_thread + 1 == total_threads) ? cull_total : ((p_thread + 1) * cull_total / total_threads);
-
-	_scene_cull(*cull_data, scene_cull_result_threads[p_thread], cull_from, cull_to);
-}
-
 void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cull_result, uint64_t p_from, uint64_t p_to) {
 	uint64_t frame_number = RSG::rasterizer->get_frame_number();
 	float lightmap_probe_update_speed = RSG::light_storage->lightmap_get_probe_capture_update_speed() * RSG::rasterizer->get_frame_delta_time();
@@ -3233,8 +3217,8 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 			}
 
 			if (visibility_cull_data.cull_count > thread_cull_threshold) {
-				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_visibility_cull_threaded, &visibility_cull_data, WorkerThreadPool::get_singleton()->get_thread_count(), -1, true, SNAME("VisibilityCullInstances"));
-				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+				WorkerThreadPool::get_singleton()->parallel_for_range(
+						visibility_cull_data.cull_offset, visibility_cull_data.cull_offset + visibility_cull_data.cull_count, 0, [this, &visibility_cull_data](uint32_t p_from, uint32_t p_to) { _visibility_cull(visibility_cull_data, p_from, p_to); }, SNAME("VisibilityCullInstances"));
 			} else {
 				_visibility_cull(visibility_cull_data, visibility_cull_data.cull_offset, visibility_cull_data.cull_offset + visibility_cull_data.cull_count);
 			}
@@ -3255,7 +3239,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 	{
 		cull.shadow_count = 0;
 
-		Vector<Instance *> lights_with_shadow;
+		FrameLocalVector<Instance *> lights_with_shadow;
 
 		for (Instance *E : scenario->directional_lights) {
 			if (!E->visible || !(E->layer_mask & p_visible_layers)) {
@@ -3281,7 +3265,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 		RSG::light_storage->set_directional_shadow_count(lights_with_shadow.size());
 
-		for (int i = 0; i < lights_with_shadow.size(); i++) {
+		for (uint32_t i = 0; i < lights_with_shadow.size(); i++) {
 			_light_instance_setup_directional_shadow(i, lights_with_shadow[i], p_camera_data->main_transform, p_camera_data->main_projection, p_camera_data->is_orthogonal, p_camera_data->vaspect);
 		}
 	}
@@ -3340,8 +3324,16 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 				thread.clear();
 			}
 
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_scene_cull_threaded, &cull_data, scene_cull_result_threads.size(), -1, true, SNAME("RenderCullInstances"));
-			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			// Chunks run on pool threads and on the calling one, so results are gathered per thread.
+			// Each pool thread has its own slot, and slot 0 is for the calling thread if it's outside the pool.
+			const Thread::ID caller_id = Thread::get_caller_id();
+			WorkerThreadPool::get_singleton()->parallel_for_range(
+					cull_from, cull_to, 0, [this, &cull_data, caller_id](uint32_t p_from, uint32_t p_to) {
+						int thread_index = WorkerThreadPool::get_thread_index();
+						DEV_ASSERT(thread_index != -1 || Thread::get_caller_id() == caller_id);
+						_scene_cull(cull_data, scene_cull_result_threads[thread_index + 1], p_from, p_to);
+					},
+					SNAME("RenderCullInstances"));
 
 			for (InstanceCullResult &thread : scene_cull_result_threads) {
 				scene_cull_result.append_from(thread);
@@ -3739,7 +3731,7 @@ void RendererSceneCull::render_probes() {
 	/* REFLECTION PROBES */
 
 	SelfList<InstanceReflectionProbeData> *ref_probe = reflection_probe_render_list.first();
-	Vector<SelfList<InstanceReflectionProbeData> *> done_list;
+	FrameLocalVector<SelfList<InstanceReflectionProbeData> *> done_list;
 
 	bool busy = false;
 
@@ -4528,7 +4520,7 @@ RendererSceneCull::RendererSceneCull() {
 	}
 
 	scene_cull_result.init(&rid_cull_page_pool, &geometry_instance_cull_page_pool, &instance_cull_page_pool);
-	scene_cull_result_threads.resize(WorkerThreadPool::get_singleton()->get_thread_count());
+	scene_cull_result_threads.resize(WorkerThreadPool::get_singleton()->get_thread_count() + 1);
 	for (InstanceCullResult &thread : scene_cull_result_threads) {
 		thread.init(&rid_cull_page_pool, &geometry_instance_cull_page_pool, &instance_cull_page_pool);
 	}
@@ -906,6 +906,9 @@ public:
 
 	HashSet<Instance *> heightfield_particle_colliders_update_list;
 
+	// Cull results, including the per-thread ones, stay in paged arrays rather than FrameLocalVector.
+	// They live across frames and their pages go back to these pools when cleared, so they don't touch
+	// the heap once warmed up. The pools are also shared with the render data passed to the scene renderer.
 	PagedArrayPool<Instance *> instance_cull_page_pool;
 	PagedArrayPool<RenderGeometryInstance *> geometry_instance_cull_page_pool;
 	PagedArrayPool<RID> rid_cull_page_pool;
@@ -1034,7 +1037,7 @@ public:
 	};
 
 	InstanceCullResult scene_cull_result;
-	LocalVector<InstanceCullResult> scene_cull_result_threads;
+	LocalVector<InstanceCullResult> scene_cull_result_threads; // One per pool thread, plus slot 0 for the render thread.
 
 	RendererSceneRender::RenderShadowData render_shadow_data[MAX_UPDATE_SHADOWS];
 	uint32_t max_shadows_used = 0;
@@ -1165,7 +1168,6 @@ public:
 		uint32_t cull_count;
 	};
 
-	void _visibility_cull_threaded(uint32_t p_thread, VisibilityCullData *cull_data);
 	void _visibility_cull(const VisibilityCullData &cull_data, uint64_t p_from, uint64_t p_to);
 	template <bool p_fade_check>
 	_FORCE_INLINE_ int _visibility_range_check(InstanceVisibilityData &r_vis_data, const Vector3 &p_camera_pos, uint64_t p_viewport_mask);
@@ -1182,7 +1184,6 @@ public:
 		uint64_t visibility_viewport_mask;
 	};
 
-	void _scene_cull_threaded(uint32_t p_thread, CullData *cull_data);
 	void _scene_cull(CullData &cull_data, InstanceCullResult &cull_result, uint64_t p_from, uint64_t p_to);
 	_FORCE_INLINE_ bool _visibility_parent_check(const CullData &p_cull_data, const InstanceData &p_instance_data);
 
@@ -107,6 +107,32 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+
+TEST_CASE("[FileAccess] Prefetching") {
+	const String file_path = TestUtils::get_temp_path("prefetch.bin");
+	const int size = 1 << 16;
+	Vector<uint8_t> source;
+	source.resize(size);
+	for (int i = 0; i < size; i++) {
+		source.write[i] = (i * 31 + (i >> 11)) & 0xFF;
+	}
+	{
+		Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(source.ptr(), size);
+	}
+
+	Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	f->seek(100);
+
+	// Only a hint to the OS, past the end of the file too.
+	f->prefetch(0, size * 2);
+
+	// The file position isn't affected.
+	CHECK(f->get_position() == 100);
+	CHECK(f->get_8() == source[100]);
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
@@ -32,7 +32,9 @@
 #define TEST_PCK_PACKER_H
 
 #include "core/io/file_access_pack.h"
+#include "core/io/marshalls.h"
 #include "core/io/pck_packer.h"
+#include "core/math/random_pcg.h"
 #include "core/os/os.h"
 
 #include "tests/test_utils.h"
@@ -62,6 +64,10 @@ TEST_CASE("[PCKPacker] Pack an empty PCK file") {
 	CHECK_MESSAGE(
 			f->get_length() <= 500,
 			"The generated empty PCK file shouldn't be too large.");
+	CHECK(f->get_32() == PACK_HEADER_MAGIC);
+	CHECK_MESSAGE(
+			f->get_32() == PACK_FORMAT_VERSION_UNCOMPRESSED,
+			"PCK files without compressed files should keep the format version older engines can read.");
 }
 
 TEST_CASE("[PCKPacker] Pack empty with zero alignment invalid") {
@@ -117,6 +123,137 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Read pack-referenced files from a memory mapping") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_mapped.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	const String base_dir = OS::get_singleton()->get_executable_path().get_base_dir();
+	REQUIRE(pck_packer.add_file("version.py", base_dir.path_join("../version.py")) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	const Vector<uint8_t> expected = f->get_buffer(f->get_length());
+
+	uint64_t mapped_length = 0;
+	const uint8_t *mapped = OS::get_singleton()->map_file(f->get_path_absolute(), mapped_length);
+	if (!mapped) {
+		MESSAGE("Memory-mapped files are not supported on this platform, skipping.");
+		return;
+	}
+	CHECK(mapped_length == (uint64_t)expected.size());
+
+	// Read the whole pack as a single pack-referenced file, once mapped and once through a file handle.
+	PackedData::PackedFile pf;
+	pf.pack = output_pck_path;
+	pf.offset = 16;
+	pf.size = expected.size() - 32;
+	pf.encrypted = false;
+	Ref<FileAccess> fa_mapped = memnew(FileAccessPack("res://mapped", pf, mapped + pf.offset));
+	Ref<FileAccess> fa_read = memnew(FileAccessPack("res://mapped", pf));
+	CHECK(fa_mapped->is_open());
+	CHECK(fa_mapped->get_length() == pf.size);
+
+	CHECK(fa_mapped->get_32() == fa_read->get_32());
+	const Vector<uint8_t> mapped_buffer = fa_mapped->get_buffer(64);
+	CHECK(mapped_buffer == fa_read->get_buffer(64));
+
+	const uint8_t *span = fa_mapped->get_mapped_span(32);
+	REQUIRE(span != nullptr);
+	CHECK(memcmp(span, expected.ptr() + pf.offset + 68, 32) == 0);
+	CHECK(fa_mapped->get_position() == 100);
+	CHECK_MESSAGE(
+			fa_read->get_mapped_span(32) == nullptr,
+			"Files read through a file handle have no mapped spans.");
+
+	// Spans past the end of the pack-referenced file are refused without moving.
+	CHECK(fa_mapped->get_mapped_span(pf.size) == nullptr);
+	CHECK(fa_mapped->get_position() == 100);
+	fa_mapped->seek(pf.size - 4);
+	CHECK(fa_mapped->get_mapped_span(4) != nullptr);
+	CHECK(fa_mapped->get_mapped_span(1) == nullptr);
+
+	fa_mapped->close();
+	OS::get_singleton()->unmap_file(mapped, mapped_length);
+}
+
+TEST_CASE("[PCKPacker] Compressed files with random access") {
+	// Text-like data that compresses well, spanning many compression blocks.
+	String text;
+	for (int i = 0; i < 40000; i++) {
+		text += vformat("Line %d of the compressed pack test.\n", i);
+	}
+	const CharString source = text.utf8();
+	const uint64_t source_size = source.length();
+	const String source_path = TestUtils::get_temp_path("pck_compression_source.txt");
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer((const uint8_t *)source.get_data(), source_size);
+	}
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_compressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	REQUIRE(pck_packer.add_file("pck_compression_test/raw.txt", source_path) == OK);
+	REQUIRE(pck_packer.add_file("pck_compression_test/compressed.txt", source_path, false, true) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	const Vector<uint8_t> pck_bytes = FileAccess::get_file_as_bytes(output_pck_path);
+	CHECK_MESSAGE(
+			pck_bytes.size() < (int64_t)(source_size + source_size / 2),
+			"The compressed copy should take much less space than the raw one.");
+	CHECK_MESSAGE(
+			decode_uint32(pck_bytes.ptr() + 4) == PACK_FORMAT_VERSION,
+			"PCK files with compressed files should be written with the current format version.");
+
+	REQUIRE(PackedData::get_singleton()->add_pack(output_pck_path, true, 0) == OK);
+	Ref<FileAccess> fa_raw = PackedData::get_singleton()->try_open_path("res://pck_compression_test/raw.txt");
+	Ref<FileAccess> fa_compressed = PackedData::get_singleton()->try_open_path("res://pck_compression_test/compressed.txt");
+	REQUIRE(fa_raw.is_valid());
+	REQUIRE(fa_compressed.is_valid());
+	CHECK(fa_compressed->get_length() == source_size);
+
+	const Vector<uint8_t> whole = fa_compressed->get_buffer(source_size);
+	CHECK(whole.size() == (int64_t)source_size);
+	CHECK(memcmp(whole.ptr(), source.get_data(), source_size) == 0);
+
+	RandomPCG rng(42);
+	bool all_match = true;
+	for (int i = 0; i < 1000; i++) {
+		const uint64_t position = rng.rand() % (source_size - 64);
+		fa_compressed->seek(position);
+		const Vector<uint8_t> chunk = fa_compressed->get_buffer(64);
+		all_match = all_match && chunk.size() == 64 && memcmp(chunk.ptr(), source.get_data() + position, 64) == 0 && fa_compressed->get_position() == position + 64;
+	}
+	CHECK_MESSAGE(all_match, "Reads at random offsets should match the source file.");
+
+	fa_compressed->seek_end();
+	CHECK(fa_compressed->get_8() == 0);
+	CHECK(fa_compressed->eof_reached());
+
+	// Random 4 KiB reads, which cross compressed block boundaries, match the same file stored raw in the pack.
+	const uint64_t READ_SIZE = 4096;
+	uint8_t raw_buffer[READ_SIZE];
+	uint8_t compressed_buffer[READ_SIZE];
+	bool all_reads_match = true;
+	for (int i = 0; i < 200; i++) {
+		const uint64_t position = rng.rand() % (source_size - READ_SIZE);
+		fa_raw->seek(position);
+		fa_compressed->seek(position);
+		const uint64_t raw_read = fa_raw->get_buffer(raw_buffer, READ_SIZE);
+		const uint64_t compressed_read = fa_compressed->get_buffer(compressed_buffer, READ_SIZE);
+		all_reads_match = all_reads_match && raw_read == READ_SIZE && compressed_read == READ_SIZE && memcmp(raw_buffer, compressed_buffer, READ_SIZE) == 0;
+	}
+	CHECK_MESSAGE(all_reads_match, "Compressed and raw entries should read the same.");
+
+	fa_raw.unref();
+	fa_compressed.unref();
+	PackedData::get_singleton()->remove_path("res://pck_compression_test/raw.txt");
+	PackedData::get_singleton()->remove_path("res://pck_compression_test/compressed.txt");
+}
+
 } // namespace TestPCKPacker
 
 #endif // TEST_PCK_PACKER_H
@@ -31,6 +31,7 @@
 #ifndef TEST_RESOURCE_H
 #define TEST_RESOURCE_H
 
+#include "core/config/project_settings.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
@@ -166,6 +167,89 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+TEST_CASE("[Resource] Threaded loading starts the dependency closure up front") {
+	const String leaf_path = TestUtils::get_temp_path("threaded_leaf.tres");
+	const String middle_path = TestUtils::get_temp_path("threaded_middle.tres");
+	const String root_path = TestUtils::get_temp_path("threaded_root.tres");
+	{
+		Ref<Resource> leaf = memnew(Resource);
+		leaf->set_name("Leaf");
+		REQUIRE(ResourceSaver::save(leaf, leaf_path) == OK);
+		leaf->set_path(leaf_path);
+
+		Ref<Resource> middle = memnew(Resource);
+		middle->set_name("Middle");
+		middle->set_meta("leaf", leaf);
+		REQUIRE(ResourceSaver::save(middle, middle_path) == OK);
+		middle->set_path(middle_path);
+
+		// The root depends on the leaf both directly and through the middle resource.
+		Ref<Resource> root = memnew(Resource);
+		root->set_name("Root");
+		root->set_meta("middle", middle);
+		root->set_meta("leaf", leaf);
+		REQUIRE(ResourceSaver::save(root, root_path) == OK);
+	}
+
+	ResourceLoader::set_load_stage_profiling(true);
+	REQUIRE(ResourceLoader::load_threaded_request(root_path, "", true) == OK);
+	Error err = FAILED;
+	Ref<Resource> root = ResourceLoader::load_threaded_get(root_path, &err);
+	REQUIRE(err == OK);
+	REQUIRE(root.is_valid());
+	CHECK(root->get_name() == "Root");
+
+	Ref<Resource> middle = root->get_meta("middle");
+	Ref<Resource> leaf = root->get_meta("leaf");
+	REQUIRE(middle.is_valid());
+	REQUIRE(leaf.is_valid());
+	CHECK(middle->get_name() == "Middle");
+	CHECK(leaf->get_name() == "Leaf");
+	CHECK_MESSAGE(
+			Ref<Resource>(middle->get_meta("leaf")) == leaf,
+			"Dependencies shared by several resources should be loaded only once.");
+
+	LocalVector<ResourceLoader::LoadStageTimes> times;
+	ResourceLoader::take_load_stage_times(times);
+	ResourceLoader::set_load_stage_profiling(false);
+	HashSet<String> timed_paths;
+	for (const ResourceLoader::LoadStageTimes &E : times) {
+		timed_paths.insert(E.path);
+	}
+	const bool all_timed = timed_paths.has(ProjectSettings::get_singleton()->localize_path(root_path)) &&
+			timed_paths.has(ProjectSettings::get_singleton()->localize_path(middle_path)) &&
+			timed_paths.has(ProjectSettings::get_singleton()->localize_path(leaf_path));
+	CHECK_MESSAGE(all_timed, "Every resource of the closure should have been loaded by its own task, and timed.");
+}
+
+TEST_CASE("[Resource] Threaded loading releases dependencies the resource doesn't use") {
+	const String unused_path = TestUtils::get_temp_path("threaded_unused.tres");
+	const String root_path = TestUtils::get_temp_path("threaded_unused_root.tres");
+	{
+		Ref<Resource> unused = memnew(Resource);
+		unused->set_name("Unused");
+		REQUIRE(ResourceSaver::save(unused, unused_path) == OK);
+	}
+	{
+		// Listed as a dependency, but no property refers to it.
+		Ref<FileAccess> f = FileAccess::open(root_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string(vformat("[gd_resource type=\"Resource\" load_steps=2 format=3]\n\n[ext_resource type=\"Resource\" path=\"%s\" id=\"1\"]\n\n[resource]\nresource_name = \"Root\"\n", ProjectSettings::get_singleton()->localize_path(unused_path)));
+	}
+
+	REQUIRE(ResourceLoader::load_threaded_request(root_path, "", true) == OK);
+	Error err = FAILED;
+	Ref<Resource> root = ResourceLoader::load_threaded_get(root_path, &err);
+	REQUIRE(err == OK);
+	REQUIRE(root.is_valid());
+	CHECK(root->get_name() == "Root");
+
+	CHECK_MESSAGE(
+			!ResourceCache::has(ProjectSettings::get_singleton()->localize_path(unused_path)),
+			"The load of an unused dependency should be finished and released along with the load that started it.");
+}
+
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
@@ -33,6 +33,7 @@
 
 #include "core/object/class_db.h"
 #include "core/object/object.h"
+#include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
 
 #include "tests/test_macros.h"
@@ -324,6 +325,79 @@ TEST_CASE("[Object] Absent name getter") {
 			"The returned value should equal nil variant.");
 }
 
+TEST_CASE("[Object] Property handles") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+	_TestDerivedObject derived_object;
+
+	PropertyHandle handle("property");
+	bool valid = false;
+	derived_object.set_by_handle(handle, 100, &valid);
+	CHECK(valid);
+	CHECK(handle.kind == PropertyHandle::KIND_NATIVE);
+	CHECK(derived_object.get_property() == 100);
+	CHECK(derived_object.get_by_handle(handle, &valid) == Variant(100));
+	CHECK(valid);
+
+	SUBCASE("Handles resolve again for another object") {
+		_TestDerivedObject other_object;
+		other_object.set_by_handle(handle, 200, &valid);
+		CHECK(valid);
+		CHECK(other_object.get_property() == 200);
+		CHECK(derived_object.get_property() == 100);
+		CHECK(handle.object == other_object.get_instance_id());
+	}
+
+	SUBCASE("Handles resolve again after the script changed") {
+		_MockScriptInstance *script_instance = memnew(_MockScriptInstance);
+		derived_object.set_script_instance(script_instance);
+		derived_object.set_by_handle(handle, 300, &valid);
+		CHECK(valid);
+		CHECK(handle.kind == PropertyHandle::KIND_GENERIC);
+		CHECK(derived_object.get_property() == 100);
+		Variant actual_value;
+		CHECK(script_instance->get("property", actual_value));
+		CHECK(actual_value == Variant(300));
+	}
+
+	SUBCASE("Absent names use the generic path") {
+		PropertyHandle absent_handle("absent_name");
+		derived_object.set_by_handle(absent_handle, 100, &valid);
+		CHECK_FALSE(valid);
+		CHECK(absent_handle.kind == PropertyHandle::KIND_GENERIC);
+		CHECK(derived_object.get_by_handle(absent_handle, &valid) == Variant());
+		CHECK_FALSE(valid);
+	}
+
+	SUBCASE("Indexed access follows the first name") {
+		PropertyHandle indexed_handle;
+		Vector<StringName> names = { "property" };
+		derived_object.set_indexed(indexed_handle, names, 400, &valid);
+		CHECK(valid);
+		CHECK(indexed_handle.name == StringName("property"));
+		CHECK(derived_object.get_indexed(indexed_handle, names) == Variant(400));
+	}
+}
+
+TEST_CASE("[Object] Property access by handle matches access by name") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+
+	_TestDerivedObject derived_object;
+	const StringName name = "property";
+	PropertyHandle handle(name);
+
+	// Alternate both ways, so each has to see what the other one set.
+	for (int i = 0; i < 100; i++) {
+		if (i % 2) {
+			derived_object.set_by_handle(handle, i);
+			CHECK(derived_object.get(name) == Variant(i));
+		} else {
+			derived_object.set(name, i);
+			CHECK(derived_object.get_by_handle(handle) == Variant(i));
+		}
+	}
+	CHECK(derived_object.get_property() == 99);
+}
+
 TEST_CASE("[Object] Signals") {
 	Object object;
 
@@ -442,6 +516,24 @@ TEST_CASE("[Object] Signals") {
 		SIGNAL_UNWATCH(&object, "my_custom_signal");
 	}
 
+	SUBCASE("Emitting a signal connected to a native method should call it with or without argument conversion") {
+		object.add_user_signal(MethodInfo("meta_signal", PropertyInfo(Variant::STRING_NAME, "name"), PropertyInfo(Variant::NIL, "value")));
+		Object target;
+		object.connect("meta_signal", Callable(&target, "set_meta"));
+
+		// Matching argument types take the validated call path.
+		CHECK(object.emit_signal("meta_signal", StringName("first"), 1) == OK);
+		CHECK(int(target.get_meta("first")) == 1);
+
+		// A String has to be converted to the StringName `set_meta()` takes.
+		CHECK(object.emit_signal("meta_signal", String("second"), 2) == OK);
+		CHECK(int(target.get_meta("second")) == 2);
+
+		ERR_PRINT_OFF;
+		CHECK_MESSAGE(object.emit_signal("meta_signal", 3) == ERR_METHOD_NOT_FOUND, "Calls with too few arguments should still fail.");
+		ERR_PRINT_ON;
+	}
+
 	SUBCASE("Connecting and then disconnecting many signals should not leave anything behind") {
 		List<Object::Connection> signal_connections;
 		Object targets[100];
@@ -466,6 +558,97 @@ TEST_CASE("[Object] Signals") {
 	}
 }
 
+class SignalReceiver : public Object {
+public:
+	int calls = 0;
+	Object *emitter = nullptr;
+	SignalReceiver *other = nullptr;
+
+	void receive() {
+		calls++;
+	}
+
+	void disconnect_other() {
+		calls++;
+		emitter->disconnect("my_signal", callable_mp(other, &SignalReceiver::receive));
+	}
+
+	void receive_bound(const Ref<RefCounted> &p_bound) {
+		calls++;
+	}
+};
+
+TEST_CASE("[Object] Signal connections changed while emitting") {
+	Object emitter;
+	emitter.add_user_signal(MethodInfo("my_signal"));
+
+	SignalReceiver first;
+	SignalReceiver second;
+	first.emitter = &emitter;
+	first.other = &second;
+
+	// Hash map order is not the connection order, so either receiver may run first.
+	emitter.connect("my_signal", callable_mp(&first, &SignalReceiver::disconnect_other));
+	emitter.connect("my_signal", callable_mp(&second, &SignalReceiver::receive));
+
+	emitter.emit_signal("my_signal");
+	CHECK_MESSAGE(second.calls == 1, "Disconnecting while emitting should only affect the next emission.");
+
+	emitter.disconnect("my_signal", callable_mp(&first, &SignalReceiver::disconnect_other));
+	emitter.connect("my_signal", callable_mp(&first, &SignalReceiver::receive));
+	emitter.emit_signal("my_signal");
+	CHECK(first.calls == 2);
+	CHECK(second.calls == 1);
+}
+
+TEST_CASE("[Object] Disconnecting releases bound arguments") {
+	Object emitter;
+	emitter.add_user_signal(MethodInfo("my_signal"));
+	SignalReceiver receiver;
+
+	Ref<RefCounted> bound;
+	bound.instantiate();
+	const ObjectID bound_id = bound->get_instance_id();
+	{
+		const Callable callable = callable_mp(&receiver, &SignalReceiver::receive_bound).bind(bound);
+		emitter.connect("my_signal", callable);
+		emitter.emit_signal("my_signal");
+		CHECK(receiver.calls == 1);
+		emitter.disconnect("my_signal", callable);
+	}
+	bound.unref();
+
+	// Nothing may keep the bound argument alive until the next emission.
+	CHECK(ObjectDB::get_instance(bound_id) == nullptr);
+}
+
+TEST_CASE("[Object] Emissions see connection changes made between them") {
+	constexpr int RECEIVER_COUNT = 100;
+
+	Object emitter;
+	emitter.add_user_signal(MethodInfo("my_signal"));
+	SignalReceiver receivers[RECEIVER_COUNT];
+	for (int i = 0; i < RECEIVER_COUNT - 1; i++) {
+		emitter.connect("my_signal", callable_mp(&receivers[i], &SignalReceiver::receive));
+	}
+
+	// The slot list is shared by emissions until connections change.
+	for (int i = 0; i < 10; i++) {
+		emitter.emit_signal("my_signal");
+	}
+	emitter.connect("my_signal", callable_mp(&receivers[RECEIVER_COUNT - 1], &SignalReceiver::receive));
+	emitter.disconnect("my_signal", callable_mp(&receivers[0], &SignalReceiver::receive));
+	emitter.emit_signal("my_signal");
+
+	bool all_called = true;
+	for (int i = 1; i < RECEIVER_COUNT - 1; i++) {
+		all_called &= receivers[i].calls == 11;
+	}
+	CHECK(all_called);
+	CHECK_MESSAGE(receivers[0].calls == 10, "A disconnected receiver should not be called anymore.");
+	CHECK_MESSAGE(receivers[RECEIVER_COUNT - 1].calls == 1, "A new connection should be called from the next emission.");
+}
+
 class NotificationObject1 : public Object {
 	GDCLASS(NotificationObject1, Object);
 
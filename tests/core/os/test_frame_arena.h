@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*  test_frame_arena.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FRAME_ARENA_H
+#define TEST_FRAME_ARENA_H
+
+#include "core/os/frame_arena.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestFrameArena {
+
+TEST_CASE("[FrameArena] Growing vectors keep their contents") {
+	for (int frame = 0; frame < 4; frame++) {
+		FrameLocalVector<int> a;
+		FrameLocalVector<int> b;
+		for (int i = 0; i < 50000; i++) {
+			a.push_back(i);
+			if (i % 3 == 0) {
+				b.push_back(-i);
+			}
+		}
+
+		bool valid = true;
+		for (int i = 0; i < 50000; i++) {
+			valid = valid && a[i] == i;
+		}
+		for (uint32_t i = 0; i < b.size(); i++) {
+			valid = valid && b[i] == -int(i * 3);
+		}
+		CHECK_MESSAGE(valid, "Interleaved growth should not corrupt either vector.");
+
+		FrameArena::end_frame();
+	}
+}
+
+TEST_CASE("[FrameArena] HashMap elements") {
+	HashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, FrameArenaTypedAllocator<HashMapElement<int, int>>> map;
+	for (int i = 0; i < 1000; i++) {
+		map[i] = i * 2;
+	}
+	map.erase(500);
+
+	CHECK(map.size() == 999);
+	CHECK(!map.has(500));
+	CHECK(map[999] == 1998);
+}
+
+static void fill_and_release(void *p_userdata) {
+	FrameLocalVector<int> *vector = (FrameLocalVector<int> *)p_userdata;
+	for (int i = 0; i < 1000; i++) {
+		vector->push_back(i);
+	}
+}
+
+TEST_CASE("[FrameArena] Blocks outlive the thread that allocated them") {
+	FrameLocalVector<int> vector;
+
+	Thread thread;
+	thread.start(fill_and_release, &vector);
+	thread.wait_to_finish();
+
+	CHECK(vector.size() == 1000);
+	CHECK(vector[999] == 999);
+
+	// Freed from this thread, which releases the other thread's arena.
+	vector.reset();
+	CHECK(vector.is_empty());
+}
+
+} // namespace TestFrameArena
+
+#endif // TEST_FRAME_ARENA_H
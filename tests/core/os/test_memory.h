@@ -0,0 +1,193 @@
+/**************************************************************************/
+/*  test_memory.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/os/memory.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestMemory {
+
+static void fill_pattern(uint8_t *p_ptr, size_t p_size, uint8_t p_seed) {
+	for (size_t i = 0; i < p_size; i++) {
+		p_ptr[i] = uint8_t(p_seed + i * 31);
+	}
+}
+
+static bool check_pattern(const uint8_t *p_ptr, size_t p_size, uint8_t p_seed) {
+	for (size_t i = 0; i < p_size; i++) {
+		if (p_ptr[i] != uint8_t(p_seed + i * 31)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("[Memory] Allocation and reallocation preserve contents across sizes") {
+	const size_t sizes[] = { 1, 8, 15, 16, 17, 100, 512, 1000, 2000, 2048, 2100, 5000, 70000 };
+
+	for (int pad = 0; pad < 2; pad++) {
+		for (size_t size : sizes) {
+			uint8_t *ptr = (uint8_t *)Memory::alloc_static(size, pad);
+			REQUIRE(ptr != nullptr);
+			CHECK_MESSAGE((uintptr_t(ptr) % alignof(max_align_t)) == 0, "Allocations should keep max_align_t alignment.");
+			fill_pattern(ptr, size, uint8_t(size));
+
+			// Grow and shrink through size class boundaries.
+			for (size_t new_size : sizes) {
+				size_t kept = MIN(size, new_size);
+				ptr = (uint8_t *)Memory::realloc_static(ptr, new_size, pad);
+				REQUIRE(ptr != nullptr);
+				CHECK_MESSAGE(check_pattern(ptr, kept, uint8_t(size)), "Reallocation should preserve contents.");
+				fill_pattern(ptr, new_size, uint8_t(size));
+				size = new_size;
+			}
+			Memory::free_static(ptr, pad);
+		}
+	}
+}
+
+static void free_blocks(void *p_userdata) {
+	LocalVector<void *> *blocks = (LocalVector<void *> *)p_userdata;
+	for (void *block : *blocks) {
+		Memory::free_static(block);
+	}
+}
+
+TEST_CASE("[Memory] Blocks can be freed by another thread") {
+	LocalVector<void *> blocks;
+	for (int i = 0; i < 10000; i++) {
+		size_t size = 16 + (i % 64) * 24;
+		uint8_t *ptr = (uint8_t *)Memory::alloc_static(size);
+		fill_pattern(ptr, size, uint8_t(i));
+		blocks.push_back(ptr);
+	}
+
+	bool intact = true;
+	for (uint32_t i = 0; i < blocks.size(); i++) {
+		intact = intact && check_pattern((const uint8_t *)blocks[i], 16 + (i % 64) * 24, uint8_t(i));
+	}
+	CHECK_MESSAGE(intact, "Live blocks should not overlap.");
+
+	Thread thread;
+	thread.start(free_blocks, &blocks);
+	thread.wait_to_finish();
+
+	// The freed blocks are reusable from here.
+	void *ptr = Memory::alloc_static(100);
+	CHECK(ptr != nullptr);
+	Memory::free_static(ptr);
+}
+
+struct ChurnData {
+	uint32_t seed = 1;
+	SafeNumeric<uint32_t> *corrupted = nullptr;
+};
+
+static void alloc_churn(void *p_userdata) {
+	ChurnData *data = (ChurnData *)p_userdata;
+	const int count = 256;
+	uint8_t *blocks[count] = {};
+	size_t sizes[count] = {};
+	uint32_t seed = data->seed;
+	for (int i = 0; i < 50000; i++) {
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		int slot = seed % count;
+		// Seeded per thread too, so blocks handed out twice across threads are caught.
+		uint8_t pattern_seed = uint8_t(slot * 7 + data->seed);
+		if (blocks[slot]) {
+			if (!check_pattern(blocks[slot], sizes[slot], pattern_seed)) {
+				data->corrupted->increment();
+			}
+			Memory::free_static(blocks[slot]);
+			blocks[slot] = nullptr;
+		} else {
+			sizes[slot] = 16 + (seed >> 8) % 1024;
+			blocks[slot] = (uint8_t *)Memory::alloc_static(sizes[slot]);
+			fill_pattern(blocks[slot], sizes[slot], pattern_seed);
+		}
+	}
+	for (int i = 0; i < count; i++) {
+		if (blocks[i]) {
+			if (!check_pattern(blocks[i], sizes[i], uint8_t(i * 7 + data->seed))) {
+				data->corrupted->increment();
+			}
+			Memory::free_static(blocks[i]);
+		}
+	}
+}
+
+TEST_CASE("[Memory] Blocks stay intact under concurrent allocation and freeing") {
+	const int thread_count = 4;
+	SafeNumeric<uint32_t> corrupted;
+	ChurnData data[thread_count];
+	Thread threads[thread_count];
+	for (int i = 0; i < thread_count; i++) {
+		data[i].seed = i * 7919 + 1;
+		data[i].corrupted = &corrupted;
+		threads[i].start(alloc_churn, &data[i]);
+	}
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	CHECK_MESSAGE(corrupted.get() == 0, "No block should have been handed out while still in use.");
+}
+
+#ifdef MEMORY_POOL_ENABLED
+TEST_CASE("[Memory] Freed blocks are reused by the thread cache") {
+	void *first = Memory::alloc_static(100);
+	Memory::free_static(first);
+	void *second = Memory::alloc_static(100);
+	CHECK_MESSAGE(second == first, "The last freed block of a size class should be handed out again.");
+	Memory::free_static(second);
+
+	// Once every size class used has a block, steady churn within the cache doesn't need new spans.
+	uint64_t reserved = 0;
+	for (int round = 0; round < 2; round++) {
+		reserved = Memory::get_pool_reserved();
+		for (int i = 0; i < 10000; i++) {
+			void *block = Memory::alloc_static(16 + (i % 32) * 16);
+			Memory::free_static(block);
+		}
+	}
+	CHECK(Memory::get_pool_reserved() == reserved);
+}
+#endif // MEMORY_POOL_ENABLED
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
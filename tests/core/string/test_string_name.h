@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	StringName from_cstr("string_name_test_interning");
+	StringName from_string(String("string_name_test_interning"));
+	StringName from_static_cstr = _scs_create("string_name_test_interning");
+
+	CHECK(from_cstr == from_string);
+	CHECK(from_cstr == from_static_cstr);
+	CHECK(from_cstr.data_unique_pointer() == from_string.data_unique_pointer());
+	CHECK(StringName::search("string_name_test_interning") == from_cstr);
+	CHECK(StringName::search(String("string_name_test_interning")) == from_cstr);
+	CHECK(String(from_cstr) == "string_name_test_interning");
+}
+
+TEST_CASE("[StringName] Released names are removed") {
+	{
+		StringName name(String("string_name_test_released"));
+		StringName copy = name;
+		CHECK(StringName::search("string_name_test_released") == name);
+	}
+	CHECK(StringName::search("string_name_test_released") == StringName());
+}
+
+TEST_CASE("[StringName] Many names") {
+	// Enough names to make the table grow several times.
+	LocalVector<StringName> names;
+	for (int i = 0; i < 50000; i++) {
+		names.push_back(StringName("string_name_test_many_" + itos(i)));
+	}
+
+	bool found_all = true;
+	for (int i = 0; i < 50000; i++) {
+		found_all = found_all && StringName::search("string_name_test_many_" + itos(i)) == names[i];
+	}
+	CHECK(found_all);
+
+	names.clear();
+	CHECK(StringName::search("string_name_test_many_0") == StringName());
+	CHECK(StringName::search("string_name_test_many_49999") == StringName());
+}
+
+struct InternThreadData {
+	const LocalVector<String> *pool = nullptr;
+	const LocalVector<StringName> *kept = nullptr;
+	uint32_t seed = 0;
+	int iterations = 0;
+	bool valid = true;
+};
+
+static void intern_names(void *p_userdata) {
+	InternThreadData *data = (InternThreadData *)p_userdata;
+	uint32_t seed = data->seed;
+	for (int i = 0; i < data->iterations; i++) {
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		uint32_t index = seed % data->pool->size();
+
+		// Half of the names are kept alive, the other half is created and freed over and over.
+		StringName name((*data->pool)[index]);
+		StringName copy = name;
+		if (copy != (*data->pool)[index] || (index < data->kept->size() && name != (*data->kept)[index])) {
+			data->valid = false;
+		}
+	}
+}
+
+TEST_CASE("[StringName] Interning from multiple threads") {
+	const int thread_count = 8;
+	const int iterations = 100000;
+
+	LocalVector<String> pool;
+	LocalVector<StringName> kept;
+	for (int i = 0; i < 512; i++) {
+		pool.push_back("string_name_test_threads_" + itos(i));
+	}
+	for (int i = 0; i < 256; i++) {
+		kept.push_back(StringName(pool[i]));
+	}
+
+	InternThreadData data[thread_count];
+	Thread threads[thread_count];
+	for (int i = 0; i < thread_count; i++) {
+		data[i].pool = &pool;
+		data[i].kept = &kept;
+		data[i].seed = i * 7919 + 1;
+		data[i].iterations = iterations;
+		threads[i].start(intern_names, &data[i]);
+	}
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	for (int i = 0; i < thread_count; i++) {
+		CHECK_MESSAGE(data[i].valid, "Names interned concurrently should resolve to the same entry.");
+	}
+
+	kept.clear();
+	CHECK(StringName::search(pool[0]) == StringName());
+	CHECK(StringName::search(pool[511]) == StringName());
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
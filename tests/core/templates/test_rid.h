@@ -31,7 +31,9 @@
 #ifndef TEST_RID_H
 #define TEST_RID_H
 
+#include "core/os/thread.h"
 #include "core/templates/rid.h"
+#include "core/templates/rid_owner.h"
 
 #include "tests/test_macros.h"
 
@@ -96,6 +98,125 @@ TEST_CASE("[RID] 'get_local_index'") {
 	CHECK(RID::from_uint64(4'294'967'295).get_local_index() == 4'294'967'295);
 	CHECK(RID::from_uint64(4'294'967'297).get_local_index() == 1);
 }
+
+TEST_CASE("[RID_Owner] Bulk allocation and free") {
+	RID_Owner<int, true> owner;
+	const uint32_t count = 1000;
+	RID rids[count];
+
+	owner.make_rids(rids, count);
+	CHECK(owner.get_rid_count() == count);
+	for (uint32_t i = 0; i < count; i++) {
+		CHECK(owner.owns(rids[i]));
+		int *value = owner.get_or_null(rids[i]);
+		REQUIRE(value != nullptr);
+		*value = i;
+	}
+	for (uint32_t i = 1; i < count; i++) {
+		CHECK(rids[i] != rids[i - 1]);
+		CHECK(*owner.get_or_null(rids[i]) == int(i));
+	}
+
+	owner.free_rids(rids, count);
+	CHECK(owner.get_rid_count() == 0);
+	for (uint32_t i = 0; i < count; i++) {
+		CHECK_FALSE(owner.owns(rids[i]));
+		CHECK(owner.get_or_null(rids[i]) == nullptr);
+	}
+}
+
+TEST_CASE("[RID_Owner] Bulk allocation then initialization") {
+	RID_Owner<int> owner;
+	RID rids[16];
+
+	CHECK(owner.allocate_rids(rids, 16) == 16);
+	for (uint32_t i = 0; i < 16; i++) {
+		owner.initialize_rid(rids[i], i * 3);
+	}
+	for (uint32_t i = 0; i < 16; i++) {
+		CHECK(*owner.get_or_null(rids[i]) == int(i * 3));
+	}
+	owner.free_rids(rids, 16);
+	CHECK(owner.get_rid_count() == 0);
+}
+
+TEST_CASE("[RID_Owner] Bulk allocation stops at the element limit") {
+	// 4 elements per chunk and at most 3 chunks.
+	RID_Owner<int, true> owner(sizeof(int) * 4, 8);
+	RID rids[20];
+
+	ERR_PRINT_OFF;
+	owner.make_rids(rids, 20);
+	ERR_PRINT_ON;
+
+	uint32_t valid = 0;
+	for (uint32_t i = 0; i < 20; i++) {
+		if (rids[i].is_valid()) {
+			CHECK(owner.owns(rids[i]));
+			valid++;
+		}
+	}
+	CHECK(valid == 12);
+	CHECK(rids[19].is_null());
+	owner.free_rids(rids, valid);
+}
+
+struct RIDOwnerReaderData {
+	RID_Owner<int, true> *owner = nullptr;
+	RID *rids = nullptr;
+	uint32_t count = 0;
+	uint32_t mismatches = 0;
+};
+
+static void rid_owner_reader(void *p_userdata) {
+	RIDOwnerReaderData *data = static_cast<RIDOwnerReaderData *>(p_userdata);
+	for (int pass = 0; pass < 100; pass++) {
+		for (uint32_t i = 0; i < data->count; i++) {
+			int *value = data->owner->get_or_null(data->rids[i]);
+			if (!value || *value != int(i)) {
+				data->mismatches++;
+			}
+		}
+	}
+}
+
+TEST_CASE("[RID_Owner] Lookups while another thread allocates") {
+	RID_Owner<int, true> owner(sizeof(int) * 64);
+	const uint32_t count = 256;
+	RID rids[count];
+	for (uint32_t i = 0; i < count; i++) {
+		rids[i] = owner.make_rid(i);
+	}
+
+	RIDOwnerReaderData data;
+	data.owner = &owner;
+	data.rids = rids;
+	data.count = count;
+
+	Thread reader;
+	reader.start(rid_owner_reader, &data);
+
+	// Growing the owner must not disturb lookups of existing RIDs.
+	RID extra[64];
+	for (int i = 0; i < 64; i++) {
+		owner.make_rids(extra, 64);
+		owner.free_rids(extra, 64);
+	}
+	for (int i = 0; i < 100; i++) {
+		owner.make_rids(extra, 64);
+	}
+
+	reader.wait_to_finish();
+	CHECK(data.mismatches == 0);
+	CHECK(owner.get_rid_count() == count + 6400);
+
+	List<RID> owned;
+	owner.get_owned_list(&owned);
+	for (const RID &E : owned) {
+		owner.free(E);
+	}
+	CHECK(owner.get_rid_count() == 0);
+}
 } // namespace TestRID
 
 #endif // TEST_RID_H
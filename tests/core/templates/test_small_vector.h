@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*  test_small_vector.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SMALL_VECTOR_H
+#define TEST_SMALL_VECTOR_H
+
+#include "core/templates/small_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSmallVector {
+
+TEST_CASE("[SmallVector] List Initialization.") {
+	SmallVector<int, 4> vector{ 0, 1, 2 };
+
+	CHECK(vector.size() == 3);
+	CHECK(vector.is_inline());
+	CHECK(vector[0] == 0);
+	CHECK(vector[1] == 1);
+	CHECK(vector[2] == 2);
+}
+
+TEST_CASE("[SmallVector] Push Back past the inline capacity.") {
+	SmallVector<int, 4> vector;
+	for (int i = 0; i < 4; i++) {
+		vector.push_back(i);
+	}
+	CHECK(vector.is_inline());
+
+	for (int i = 4; i < 100; i++) {
+		vector.push_back(i);
+	}
+	CHECK_FALSE(vector.is_inline());
+	CHECK(vector.size() == 100);
+	for (int i = 0; i < 100; i++) {
+		CHECK(vector[i] == i);
+	}
+
+	vector.reset();
+	CHECK(vector.is_empty());
+	CHECK(vector.is_inline());
+	CHECK(vector.get_capacity() == 4);
+}
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[SmallVector] No allocations while inline.") {
+	uint64_t usage = Memory::get_mem_usage();
+	{
+		SmallVector<int, 16> vector;
+		for (int i = 0; i < 16; i++) {
+			vector.push_back(i);
+		}
+		SmallVector<int, 16> copy = vector;
+		CHECK(copy[15] == 15);
+	}
+	CHECK(Memory::get_mem_usage() == usage);
+}
+#endif
+
+TEST_CASE("[SmallVector] Non-trivial elements.") {
+	SmallVector<String, 2> vector;
+	vector.push_back("zero");
+	vector.push_back("one");
+	vector.push_back("two");
+	vector.push_back("three");
+
+	vector.remove_at(1);
+	CHECK(vector.size() == 3);
+	CHECK(vector[0] == "zero");
+	CHECK(vector[1] == "two");
+	CHECK(vector[2] == "three");
+
+	vector.remove_at_unordered(0);
+	CHECK(vector.size() == 2);
+	CHECK(vector[0] == "three");
+	CHECK(vector.has("two"));
+	CHECK(vector.find("one") == -1);
+
+	SmallVector<String, 2> copy = vector;
+	vector.clear();
+	CHECK(copy.size() == 2);
+	CHECK(copy[1] == "two");
+}
+
+TEST_CASE("[SmallVector] Resize and iteration.") {
+	SmallVector<int, 8> vector;
+	vector.resize(5);
+	int i = 0;
+	for (int &value : vector) {
+		value = i++;
+	}
+	vector.resize(20);
+	CHECK(vector.size() == 20);
+	CHECK(vector[4] == 4);
+
+	vector.resize(3);
+	int sum = 0;
+	for (const int &value : vector) {
+		sum += value;
+	}
+	CHECK(sum == 3);
+}
+
+} // namespace TestSmallVector
+
+#endif // TEST_SMALL_VECTOR_H
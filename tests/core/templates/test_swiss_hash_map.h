@@ -0,0 +1,240 @@
+/**************************************************************************/
+/*  test_swiss_hash_map.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SWISS_HASH_MAP_H
+#define TEST_SWISS_HASH_MAP_H
+
+#include "core/templates/swiss_hash_map.h"
+
+#include "core/templates/a_hash_map.h"
+#include "core/templates/oa_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSwissHashMap {
+
+TEST_CASE("[SwissHashMap] Insert element") {
+	SwissHashMap<int, int> map;
+	SwissHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[SwissHashMap] Overwrite element") {
+	SwissHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[SwissHashMap] Erase via element") {
+	SwissHashMap<int, int> map;
+	SwissHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[SwissHashMap] Erase via key") {
+	SwissHashMap<int, int> map;
+	map.insert(42, 84);
+	CHECK(map.erase(42));
+	CHECK(!map.erase(42));
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+}
+
+TEST_CASE("[SwissHashMap] Lookups on an empty map") {
+	SwissHashMap<int, int> map;
+	CHECK(!map.has(1));
+	CHECK(map.getptr(1) == nullptr);
+	CHECK(!map.find(1));
+	CHECK(map.begin() == map.end());
+	CHECK(map.get_capacity() == 0);
+}
+
+TEST_CASE("[SwissHashMap] Grow and iterate") {
+	SwissHashMap<int, int> map;
+	const int count = 1000;
+	for (int i = 0; i < count; i++) {
+		map.insert(i, i * 2);
+	}
+	CHECK(map.size() == count);
+	CHECK(map.get_capacity() >= count);
+
+	int visited = 0;
+	int64_t key_sum = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.value == E.key * 2);
+		key_sum += E.key;
+		visited++;
+	}
+	CHECK(visited == count);
+	CHECK(key_sum == int64_t(count) * (count - 1) / 2);
+
+	for (int i = 0; i < count; i++) {
+		int *value = map.getptr(i);
+		REQUIRE(value != nullptr);
+		CHECK(*value == i * 2);
+	}
+	CHECK(!map.has(count));
+}
+
+TEST_CASE("[SwissHashMap] Remove while iterating") {
+	SwissHashMap<int, int> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, i);
+	}
+
+	for (SwissHashMap<int, int>::Iterator E = map.begin(); E; ++E) {
+		if (E->key % 2) {
+			map.remove(E);
+		}
+	}
+
+	CHECK(map.size() == 50);
+	for (int i = 0; i < 100; i++) {
+		CHECK(map.has(i) == !(i % 2));
+	}
+}
+
+TEST_CASE("[SwissHashMap] Churn matches HashMap") {
+	// Interleaved inserts and erases leave tombstones behind, which must not break lookups
+	// and must be reclaimed instead of growing the table forever.
+	SwissHashMap<int, int> map;
+	HashMap<int, int> reference;
+	uint32_t state = 1234;
+	for (int i = 0; i < 100000; i++) {
+		state = state * 1664525u + 1013904223u;
+		const int key = (state >> 8) % 512;
+		if (state & 1) {
+			map.insert(key, i);
+			reference.insert(key, i);
+		} else {
+			CHECK(map.erase(key) == reference.erase(key));
+		}
+	}
+
+	CHECK(map.size() == reference.size());
+	CHECK(map.get_capacity() <= 1024);
+	for (const KeyValue<int, int> &E : reference) {
+		const int *value = map.getptr(E.key);
+		REQUIRE(value != nullptr);
+		CHECK(*value == E.value);
+	}
+}
+
+TEST_CASE("[SwissHashMap] String keys, copy and clear") {
+	SwissHashMap<String, int> map;
+	for (int i = 0; i < 200; i++) {
+		map[itos(i)] = i;
+	}
+
+	SwissHashMap<String, int> copy = map;
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(!map.has("7"));
+
+	CHECK(copy.size() == 200);
+	for (int i = 0; i < 200; i++) {
+		CHECK(copy.get(itos(i)) == i);
+	}
+
+	map = copy;
+	copy.reset();
+	CHECK(copy.get_capacity() == 0);
+	CHECK(map.size() == 200);
+	CHECK(map["199"] == 199);
+}
+
+TEST_CASE("[SwissHashMap] Reserve") {
+	SwissHashMap<int, int> map;
+	map.reserve(1000);
+	const uint32_t capacity = map.get_capacity();
+	CHECK(capacity >= 1000);
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i, i);
+	}
+	CHECK(map.get_capacity() == capacity);
+}
+
+template <typename M>
+static uint32_t _fill_and_probe(M &p_map, const LocalVector<uint32_t> &p_keys) {
+	for (uint32_t key : p_keys) {
+		p_map.insert(key, key);
+	}
+	uint32_t found = 0;
+	for (uint32_t key : p_keys) {
+		found += p_map.has(key) + p_map.has(key ^ 0x80000000);
+	}
+	return found;
+}
+
+TEST_CASE("[SwissHashMap] Random keys agree with the other hash maps") {
+	const uint32_t count = 200000;
+	LocalVector<uint32_t> keys;
+	keys.resize(count);
+	uint32_t state = 42;
+	for (uint32_t i = 0; i < count; i++) {
+		state = state * 1664525u + 1013904223u;
+		keys[i] = state & 0x7FFFFFFF; // Some repeat.
+	}
+
+	HashMap<uint32_t, uint32_t> hash_map;
+	AHashMap<uint32_t, uint32_t> a_hash_map;
+	OAHashMap<uint32_t, uint32_t> oa_hash_map;
+	SwissHashMap<uint32_t, uint32_t> swiss_hash_map;
+	const uint32_t found = _fill_and_probe(hash_map, keys);
+	CHECK(_fill_and_probe(a_hash_map, keys) == found);
+	CHECK(_fill_and_probe(oa_hash_map, keys) == found);
+	CHECK(_fill_and_probe(swiss_hash_map, keys) == found);
+
+	// Half of the probes are misses, so every key must have been found exactly once.
+	CHECK(found == count);
+	CHECK(swiss_hash_map.size() == hash_map.size());
+	bool same_contents = true;
+	for (const KeyValue<uint32_t, uint32_t> &E : swiss_hash_map) {
+		const uint32_t *value = hash_map.getptr(E.key);
+		same_contents &= value && *value == E.value;
+	}
+	CHECK(same_contents);
+}
+
+} // namespace TestSwissHashMap
+
+#endif // TEST_SWISS_HASH_MAP_H
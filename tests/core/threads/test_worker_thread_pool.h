@@ -173,6 +173,155 @@ TEST_CASE("[WorkerThreadPool] Run a yielding daemon as the only hope for other t
 	CHECK_MESSAGE(all_needed_yield, "All legit tasks should have needed the daemon yielding to run.");
 }
 
+static const uint32_t NESTED_CHILDREN = 256;
+
+static void static_nested_child_task(void *p_arg) {
+	counter[(uintptr_t)p_arg].increment();
+}
+
+static void static_nested_root_task(void *p_arg) {
+	const uint32_t first_child = (uintptr_t)p_arg;
+	WorkerThreadPool::TaskID child_ids[NESTED_CHILDREN];
+	// Spawned from a pool thread, so these go to its own deque and are stolen by idle threads.
+	for (uint32_t i = 0; i < NESTED_CHILDREN; i++) {
+		child_ids[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_child_task, (void *)(uintptr_t)(first_child + i), true);
+	}
+	// Awaited oldest first, so most are still in the deque and get popped or stolen while waiting.
+	for (uint32_t i = 0; i < NESTED_CHILDREN; i++) {
+		if (WorkerThreadPool::get_singleton()->wait_for_task_completion(child_ids[i]) != OK) {
+			return;
+		}
+		if (counter[first_child + i].get() != 1) {
+			return; // Completed before having run.
+		}
+	}
+	counter[0].increment();
+}
+
+TEST_CASE("[WorkerThreadPool] Nested tasks spawned from pool threads run exactly once") {
+	const uint32_t roots = MAX(1, WorkerThreadPool::get_singleton()->get_thread_count()) * 4;
+
+	counter.clear();
+	counter.resize(1 + roots * NESTED_CHILDREN);
+
+	LocalVector<WorkerThreadPool::TaskID> root_ids;
+	root_ids.resize(roots);
+	for (uint32_t i = 0; i < roots; i++) {
+		root_ids[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_root_task, (void *)(uintptr_t)(1 + i * NESTED_CHILDREN), true);
+	}
+	for (uint32_t i = 0; i < roots; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(root_ids[i]);
+	}
+
+	CHECK_MESSAGE(counter[0].get() == int(roots), "Every child should have been complete when its wait returned.");
+	bool all_run_once = true;
+	for (uint32_t i = 1; i < counter.size(); i++) {
+		all_run_once &= counter[i].get() == 1;
+	}
+	CHECK_MESSAGE(all_run_once, "Popped and stolen tasks should run exactly once.");
+}
+
+TEST_CASE("[WorkerThreadPool] Parallel for visits every element exactly once") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const uint32_t count = Math::rand() % 5000;
+		const uint32_t grain = Math::rand() % 64; // Zero picks one automatically.
+
+		counter.clear();
+		counter.resize(count + 1);
+		WorkerThreadPool::get_singleton()->parallel_for(1, count + 1, grain, [](uint32_t p_index) {
+			counter[p_index].increment();
+		});
+
+		bool all_run_once = counter[0].get() == 0;
+		for (uint32_t i = 1; i <= count; i++) {
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Nested parallel for") {
+	const uint32_t outer = 64;
+	const uint32_t inner = 1000;
+
+	counter.clear();
+	counter.resize(outer);
+	// Every outer element forks its own inner loop from within a pool thread; this must not deadlock.
+	WorkerThreadPool::get_singleton()->parallel_for(0, outer, 1, [](uint32_t p_outer) {
+		WorkerThreadPool::get_singleton()->parallel_for_range(0, inner, 0, [p_outer](uint32_t p_from, uint32_t p_to) {
+			counter[p_outer].add(p_to - p_from);
+		});
+	});
+
+	bool all_complete = true;
+	for (uint32_t i = 0; i < outer; i++) {
+		all_complete &= counter[i].get() == int(inner);
+	}
+	CHECK(all_complete);
+}
+
+struct GraphTestData {
+	SafeNumeric<uint32_t> clock;
+	uint32_t finish_time[8] = {};
+	uint32_t start_time[8] = {};
+};
+
+static GraphTestData *graph_test_data = nullptr;
+
+static void static_graph_node(void *p_arg) {
+	uint32_t node = (uintptr_t)p_arg;
+	graph_test_data->start_time[node] = graph_test_data->clock.increment();
+	OS::get_singleton()->delay_usec(100);
+	graph_test_data->finish_time[node] = graph_test_data->clock.increment();
+}
+
+TEST_CASE("[WorkerThreadPool] Task graph honors dependencies") {
+	// 0 -> (1, 2, 3) -> 4, plus 5 -> 6 unrelated to the rest, and 7 depending on 4 and 6.
+	GraphTestData data;
+	graph_test_data = &data;
+
+	WorkerThreadPool::TaskGraph graph;
+	for (uintptr_t i = 0; i < 8; i++) {
+		graph.add_native_task(static_graph_node, (void *)i);
+	}
+	graph.add_dependency(0, 1);
+	graph.add_dependency(0, 2);
+	graph.add_dependency(0, 3);
+	graph.add_dependency(1, 4);
+	graph.add_dependency(2, 4);
+	graph.add_dependency(3, 4);
+	graph.add_dependency(5, 6);
+	graph.add_dependency(4, 7);
+	graph.add_dependency(6, 7);
+
+	ERR_PRINT_OFF;
+	graph.add_dependency(7, 3); // Would create a cycle.
+	ERR_PRINT_ON;
+
+	WorkerThreadPool::TaskID graph_task = WorkerThreadPool::get_singleton()->add_task_graph(&graph, true);
+	CHECK(WorkerThreadPool::get_singleton()->wait_for_task_completion(graph_task) == OK);
+
+	for (uint32_t i = 0; i < 8; i++) {
+		CHECK(data.finish_time[i] != 0);
+	}
+	for (uint32_t i = 1; i <= 3; i++) {
+		CHECK(data.start_time[i] > data.finish_time[0]);
+		CHECK(data.start_time[4] > data.finish_time[i]);
+	}
+	CHECK(data.start_time[6] > data.finish_time[5]);
+	CHECK(data.start_time[7] > data.finish_time[4]);
+	CHECK(data.start_time[7] > data.finish_time[6]);
+
+	graph_test_data = nullptr;
+}
+
+TEST_CASE("[WorkerThreadPool] Empty task graph completes right away") {
+	WorkerThreadPool::TaskGraph graph;
+	WorkerThreadPool::TaskID graph_task = WorkerThreadPool::get_singleton()->add_task_graph(&graph);
+	CHECK(WorkerThreadPool::get_singleton()->is_task_completed(graph_task));
+	CHECK(WorkerThreadPool::get_singleton()->wait_for_task_completion(graph_task) == OK);
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
@@ -2216,6 +2216,58 @@ TEST_CASE("[Variant] Operator NOT") {
 	}
 }
 
+TEST_CASE("[Variant] Four-component real types storage") {
+#ifdef VARIANT_REAL4_IN_BUCKET
+	// These types live in the small bucket, the Variant itself only holds the pointer.
+	CHECK_EQ(sizeof(Variant), sizeof(uint64_t) + sizeof(float) * 4);
+#endif
+
+	const Rect2 rect = Rect2(1.5, 2.5, 3.5, 4.5);
+	const Vector4 vec4 = Vector4(1.25, -2.5, 3.75, -5);
+	const Plane plane = Plane(Vector3(0, 1, 0), 2.5);
+	const Quaternion quat = Quaternion(Vector3(0, 0, 1), Math_PI / 3);
+
+	Variant v_rect = rect;
+	Variant v_vec4 = vec4;
+	Variant v_plane = plane;
+	Variant v_quat = quat;
+	CHECK_EQ(Rect2(v_rect), rect);
+	CHECK_EQ(Vector4(v_vec4), vec4);
+	CHECK_EQ(Plane(v_plane), plane);
+	CHECK_EQ(Quaternion(v_quat), quat);
+
+	// Copies must not share storage with the original.
+	Variant v_rect_copy = v_rect;
+	v_rect = Rect2();
+	CHECK_EQ(Rect2(v_rect_copy), rect);
+	CHECK_EQ(Rect2(v_rect), Rect2());
+
+	// Changing between these types reuses or releases the storage correctly.
+	Variant v = quat;
+	v = plane;
+	CHECK_EQ(Plane(v), plane);
+	v = vec4;
+	CHECK_EQ(Vector4(v), vec4);
+	v = 42;
+	CHECK_EQ(int(v), 42);
+	v = rect;
+	CHECK_EQ(Rect2(v), rect);
+	v = Variant();
+	CHECK_EQ(v.get_type(), Variant::NIL);
+
+	// Members are accessed in place.
+	bool valid = false;
+	v_quat.set(StringName("w"), 0.5, &valid);
+	CHECK(valid);
+	CHECK_EQ(double(v_quat.get(StringName("w"))), 0.5);
+
+	// Default construction through the type tables.
+	Callable::CallError err;
+	Variant::construct(Variant::PLANE, v, nullptr, 0, err);
+	REQUIRE_EQ(err.error, Callable::CallError::CALL_OK);
+	CHECK_EQ(Plane(v), Plane());
+}
+
 } // namespace TestVariant
 
 #endif // TEST_VARIANT_H
@@ -81,10 +81,13 @@
 #include "tests/core/object/test_method_bind.h"
 #include "tests/core/object/test_object.h"
 #include "tests/core/object/test_undo_redo.h"
+#include "tests/core/os/test_frame_arena.h"
+#include "tests/core/os/test_memory.h"
 #include "tests/core/os/test_os.h"
 #include "tests/core/string/test_fuzzy_search.h"
 #include "tests/core/string/test_node_path.h"
 #include "tests/core/string/test_string.h"
+#include "tests/core/string/test_string_name.h"
 #include "tests/core/string/test_translation.h"
 #include "tests/core/string/test_translation_server.h"
 #include "tests/core/templates/test_a_hash_map.h"
@@ -97,6 +100,8 @@
 #include "tests/core/templates/test_oa_hash_map.h"
 #include "tests/core/templates/test_paged_array.h"
 #include "tests/core/templates/test_rid.h"
+#include "tests/core/templates/test_small_vector.h"
+#include "tests/core/templates/test_swiss_hash_map.h"
 #include "tests/core/templates/test_vector.h"
 #include "tests/core/test_crypto.h"
 #include "tests/core/test_hashing_context.h"